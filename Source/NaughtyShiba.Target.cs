@@ -16,6 +16,9 @@ public class NaughtyShibaTarget : TargetRules
 		bUseUnityBuild = true;
 		bUsePCHFiles = true;
 		bForceEnableExceptions = false;
+
+		// Push-model replication for AShibaCharacter
+		bWithPushModel = true;
 	}
 	
 }
@@ -13,25 +13,39 @@ public class NaughtyShiba : ModuleRules
             "CoreUObject",             // UObject system
             "Engine",                  // Main engine functionality
             "InputCore",               // Input handling
-            "HeadMountedDisplay",      // VR support (future-proofing)
-            "UMG",                     // UI system
+            "UMG",                     // UI system (UBaseWidget derives UUserWidget, so servers still link it)
             "Slate",                   // Low-level UI
             "SlateCore",               // UI core
             "OnlineSubsystem",         // Multiplayer foundation
             "OnlineSubsystemUtils",    // Multiplayer utilities
+            "NetCore",                 // Push-model replication
+            "ReplicationGraph",        // UNaughtyReplicationGraph
             "EnhancedInput",           // Modern input system
             "StructUtils",             // Required for GMCv2
             "GMCCore",                 // GMCv2 main module
-            "ToolMenus",               // UI framework support
             "DeveloperSettings"        // For save system settings
         });
 
         // Modules we don't want to expose in headers
         PrivateDependencyModuleNames.AddRange(new string[] { 
             "EngineSettings",          // Engine configuration access
-            "AudioMixer"               // Audio system support
+            "RenderCore",              // Thread timings for the perf overlay
+            "Json"                     // Benchmark reports
         });
 
+        // Client-only modules - dedicated servers have no display, audio or editor menus
+        if (Target.Type != TargetType.Server)
+        {
+            PublicDependencyModuleNames.AddRange(new string[] {
+                "HeadMountedDisplay",      // VR support (future-proofing)
+                "ToolMenus"                // UI framework support
+            });
+
+            PrivateDependencyModuleNames.AddRange(new string[] {
+                "AudioMixer"               // Audio system support
+            });
+        }
+
         // SUPPRESS COMMON BUILD WARNINGS (NEW SECTION)
         PublicDefinitions.AddRange(new string[]
         {
@@ -1,5 +1,7 @@
 #include "NaughtyShiba.h"
 #include "Modules/ModuleManager.h"
+#include "Systems/NaughtyProfiler.h"
+#include "Systems/NaughtyDebugChannels.h"
 
 DEFINE_LOG_CATEGORY(LogNaughtyShiba);
 
@@ -7,11 +9,21 @@ void FNaughtyShibaModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory
 	UE_LOG(LogNaughtyShiba, Warning, TEXT("NaughtyShiba module has started"));
+
+#if NAUGHTY_PROFILING
+	FNaughtyProfiler::Startup();
+#endif
+
+	FNaughtyDebugChannels::InitFromCommandLine();
 }
 
 void FNaughtyShibaModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module
+#if NAUGHTY_PROFILING
+	FNaughtyProfiler::Shutdown();
+#endif
+
 	UE_LOG(LogNaughtyShiba, Warning, TEXT("NaughtyShiba module has shut down"));
 }
 
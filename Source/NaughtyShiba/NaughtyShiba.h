@@ -14,12 +14,15 @@ public:
 	virtual void ShutdownModule() override;
 };
 
+// Servers have no screen to print to - on-screen debug output compiles out of server builds
+#define NAUGHTY_WITH_SCREEN_DEBUG (!UE_SERVER)
+
 // Development helper macros
 #if NAUGHTY_DEBUG
 #define NAUGHTY_LOG(Level, Format, ...) UE_LOG(LogNaughtyShiba, Level, Format, ##__VA_ARGS__)
 #define NAUGHTY_LOG_FUNC() UE_LOG(LogNaughtyShiba, VeryVerbose, TEXT("Entering %s"), *FString(__FUNCTION__))
 #define NAUGHTY_LOG_SCREEN(Format, ...) \
-if (GEngine) { GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Yellow, FString::Printf(Format, ##__VA_ARGS__)); }
+if (NAUGHTY_WITH_SCREEN_DEBUG && GEngine) { GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Yellow, FString::Printf(Format, ##__VA_ARGS__)); }
 #else
 #define NAUGHTY_LOG(Level, Format, ...)
 #define NAUGHTY_LOG_FUNC()
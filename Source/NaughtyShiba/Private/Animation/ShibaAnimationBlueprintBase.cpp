@@ -1,5 +1,7 @@
 #include "Animation/ShibaAnimationBlueprintBase.h"
 #include "Characters/ShibaCharacter.h"
+#include "Systems/NaughtyProfiler.h"
+#include "Components/SkeletalMeshComponent.h"
 
 UShibaAnimationBlueprintBase::UShibaAnimationBlueprintBase()
 {
@@ -19,17 +21,62 @@ void UShibaAnimationBlueprintBase::NativeInitializeAnimation()
         Speed = ShibaCharacter->GetVelocity().Size();
         PreviousSpeed = Speed;
     }
+
+    ConfigureUpdateRateOptimizations();
+}
+
+void UShibaAnimationBlueprintBase::ConfigureUpdateRateOptimizations()
+{
+    USkeletalMeshComponent* Mesh = GetSkelMeshComponent();
+    if (!bConfigureUpdateRateOptimizations || !Mesh || !Mesh->bEnableUpdateRateOptimizations)
+    {
+        return;
+    }
+
+    // Params are created when the mesh registers with URO enabled (see AShibaCharacter constructor)
+    FAnimUpdateRateParameters* Params = Mesh->AnimUpdateRateParams;
+    if (!Params)
+    {
+        return;
+    }
+
+    // Skip frames by LOD rather than by screen size so the rate follows our LOD setup
+    Params->bShouldUseLodMap = true;
+    Params->LODToFrameSkipMap.Reset();
+    for (int32 LODIndex = 0; LODIndex < FrameSkipPerLOD.Num(); ++LODIndex)
+    {
+        Params->LODToFrameSkipMap.Add(LODIndex, FMath::Max(FrameSkipPerLOD[LODIndex], 0));
+    }
+
+    // Blend between evaluated poses on skipped frames
+    Params->bInterpolateSkippedFrames = true;
+    Params->MaxEvalRateForInterpolation = MaxEvalRateForInterpolation;
+    Params->BaseNonRenderedUpdateRate = NonRenderedUpdateRate;
 }
 
 void UShibaAnimationBlueprintBase::NativeUpdateAnimation(float DeltaTimeX)
 {
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_ShibaAnimGather, Animation);
+
     Super::NativeUpdateAnimation(DeltaTimeX);
 
-    if (!ShibaCharacter)
+    // Game thread work is limited to the snapshot copy; everything else runs in NativeThreadSafeUpdateAnimation
+    GatherSnapshot();
+}
+
+void UShibaAnimationBlueprintBase::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_ShibaAnimThreadSafe, Animation);
+
+    Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+    if (!Snapshot.bIsValid)
     {
         return;
     }
 
+    bUseReducedGraph = Snapshot.bUseReducedGraph;
+
     // Update all animation properties
     UpdateMovementProperties();
     UpdateStateProperties();
@@ -39,45 +86,59 @@ void UShibaAnimationBlueprintBase::NativeUpdateAnimation(float DeltaTimeX)
     PreviousSpeed = Speed;
 }
 
+void UShibaAnimationBlueprintBase::GatherSnapshot()
+{
+    Snapshot.bIsValid = ShibaCharacter != nullptr;
+    if (!Snapshot.bIsValid)
+    {
+        return;
+    }
+
+    // One call per value - the worker thread derives everything else from these
+    Snapshot.Velocity = ShibaCharacter->GetVelocity();
+    Snapshot.RightVector = ShibaCharacter->GetActorRightVector();
+    Snapshot.State = ShibaCharacter->GetCharacterState();
+    Snapshot.bIsGrounded = ShibaCharacter->IsGrounded();
+
+    // Far/off-screen dogs and low mesh LODs run the locomotion-only graph
+    const USkeletalMeshComponent* Mesh = GetSkelMeshComponent();
+    Snapshot.bUseReducedGraph = ShibaCharacter->GetSignificanceTier() >= EShibaSignificanceTier::Far
+        || (Mesh && Mesh->GetPredictedLODLevel() >= ReducedGraphMinLOD);
+}
+
 void UShibaAnimationBlueprintBase::UpdateMovementProperties()
 {
-    // Get raw movement data directly from character
-    Speed = ShibaCharacter->GetVelocity().Size();
-    Direction = CalculateDirection();
+    // Raw movement data from the snapshot
+    Speed = Snapshot.Velocity.Size();
 
-    // Calculate movement state
-    bIsMoving = ShibaCharacter->IsMoving();
-    bIsGrounded = ShibaCharacter->IsGrounded();
+    // Calculate movement state (same threshold as AShibaCharacter::IsMoving)
+    bIsMoving = Speed > 10.0f;
+    bIsGrounded = Snapshot.bIsGrounded;
+
+    Direction = CalculateDirection();
 
     // Calculate if accelerating (simple comparison)
     bIsAccelerating = (Speed > PreviousSpeed + 1.0f) && bIsMoving;
 
     // Simple turn in place check
     bIsTurningInPlace = !bIsMoving && FMath::Abs(Direction) > 0.1f;
-
-    // DEBUGGING: Log values for blend space setup
-    if (bIsMoving && GEngine)
-    {
-        GEngine->AddOnScreenDebugMessage(-1, 0.1f, FColor::Cyan, 
-            FString::Printf(TEXT("ANIM: Speed=%.1f, Direction=%.2f"), Speed, Direction));
-    }
 }
 
 void UShibaAnimationBlueprintBase::UpdateStateProperties()
 {
     // Get current character state
-    CurrentState = ShibaCharacter->GetCharacterState();
+    CurrentState = Snapshot.State;
 
     // Update state booleans
-    bIsJumping = ShibaCharacter->IsInState(EShibaCharacterState::Jumping);
-    bIsFalling = ShibaCharacter->IsInState(EShibaCharacterState::Falling);
-    bIsSprinting = ShibaCharacter->IsInState(EShibaCharacterState::Sprinting);
-    bIsCrouching = ShibaCharacter->IsInState(EShibaCharacterState::Crouching);
+    bIsJumping = CurrentState == EShibaCharacterState::Jumping;
+    bIsFalling = CurrentState == EShibaCharacterState::Falling;
+    bIsSprinting = CurrentState == EShibaCharacterState::Sprinting;
+    bIsCrouching = CurrentState == EShibaCharacterState::Crouching;
 
     // Calculate fall speed for landing animations
     if (bIsFalling)
     {
-        FallSpeed = FMath::Abs(ShibaCharacter->GetVelocity().Z);
+        FallSpeed = FMath::Abs(Snapshot.Velocity.Z);
     }
     else
     {
@@ -87,35 +148,32 @@ void UShibaAnimationBlueprintBase::UpdateStateProperties()
 
 void UShibaAnimationBlueprintBase::UpdateActionProperties()
 {
-    // Update action states directly from character
-    bIsBarking = ShibaCharacter->IsInState(EShibaCharacterState::Barking);
-    bIsHowling = ShibaCharacter->IsInState(EShibaCharacterState::Howling);
-    bIsSniffing = ShibaCharacter->IsInState(EShibaCharacterState::Sniffing);
-    bIsCarrying = ShibaCharacter->IsInState(EShibaCharacterState::Carrying);
-    bIsDigging = ShibaCharacter->IsInState(EShibaCharacterState::Digging);
+    // Update action states from the snapshot state
+    bIsBarking = CurrentState == EShibaCharacterState::Barking;
+    bIsHowling = CurrentState == EShibaCharacterState::Howling;
+    bIsSniffing = CurrentState == EShibaCharacterState::Sniffing;
+    bIsCarrying = CurrentState == EShibaCharacterState::Carrying;
+    bIsDigging = CurrentState == EShibaCharacterState::Digging;
 }
 
 float UShibaAnimationBlueprintBase::CalculateDirection() const
 {
-    if (!bIsMoving || !ShibaCharacter)
+    if (!bIsMoving)
     {
         return 0.0f;
     }
 
-    // Get character forward vector and velocity
-    FVector ForwardVector = ShibaCharacter->GetActorForwardVector();
-    FVector RightVector = ShibaCharacter->GetActorRightVector();
-    FVector Velocity = ShibaCharacter->GetVelocity();
+    // Get character right vector and velocity from the snapshot
+    FVector RightVector = Snapshot.RightVector;
+    FVector Velocity = Snapshot.Velocity;
     
     // Remove Z component for 2D calculation
-    ForwardVector.Z = 0.0f;
     RightVector.Z = 0.0f;
     Velocity.Z = 0.0f;
     
-    ForwardVector.Normalize();
     RightVector.Normalize();
     Velocity.Normalize();
 
     // Return the right component (positive = turning right, negative = turning left)
     return FVector::DotProduct(Velocity, RightVector);
-}
\ No newline at end of file
+}
@@ -1,10 +1,16 @@
 #include "Characters/ShibaCharacter.h"
+#include "NaughtyShiba.h"
+#include "Characters/ShibaStateMachine.h"
 #include "Components/InputManagerComponent.h"
 #include "Systems/DebugConsole.h"
+#include "Systems/ShibaActionScheduler.h"
+#include "Systems/NaughtyProfiler.h"
+#include "Systems/NaughtyDebugChannels.h"
 #include "Movement/ShibaGMCMovement.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/World.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GMCFlatCapsuleComponent.h"
 #include "Engine/Engine.h"
@@ -17,6 +23,7 @@ AShibaCharacter::AShibaCharacter(const FObjectInitializer& ObjectInitializer)
     WalkMultiplier = 0.5f;
     CrouchMultiplier = 0.3f;
     JumpVelocity = 450.0f;
+    LastStateEvaluationKey = FShibaStateMachine::InvalidEvaluationKey;
     
     // Set default GMCv2 settings
     bReplicates = true;
@@ -46,6 +53,9 @@ AShibaCharacter::AShibaCharacter(const FObjectInitializer& ObjectInitializer)
     ShibaMesh->SetRelativeRotation(FRotator(0.0f, -90.0f, 0.0f));
     ShibaMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
+    // Update rate optimization; UShibaAnimationBlueprintBase configures the frame-skip parameters
+    ShibaMesh->bEnableUpdateRateOptimizations = true;
+
     // Create camera boom (attach to flat capsule)
     CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
     CameraBoom->SetupAttachment(FlatCapsule);
@@ -111,12 +121,41 @@ void AShibaCharacter::BeginPlay()
         bInputEventsAlreadyBound = true;
     }
 
+    // Dedicated servers keep the camera components (Blueprints and saved instances reference them) but never run them
+    if (GetNetMode() == NM_DedicatedServer)
+    {
+        CameraBoom->Deactivate();
+        CameraBoom->SetComponentTickEnabled(false);
+        ThirdPersonCamera->Deactivate();
+        ThirdPersonCamera->SetComponentTickEnabled(false);
+    }
+
     // Cache initial location
     LastValidLocation = GetActorLocation();
+
+    // Per-frame logic runs inside UShibaGMCMovement's movement callbacks in this mode
+    if (bDriveLogicFromMovement)
+    {
+        SetActorTickEnabled(false);
+    }
+
+    // Let the significance manager throttle us when we're a remote dog far from the camera
+    if (UShibaSignificanceManager* Significance = UShibaSignificanceManager::Get(this))
+    {
+        Significance->RegisterCharacter(this);
+    }
 }
 
 void AShibaCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    // Drop pending timed actions so nothing fires on a dead character
+    CancelScheduledActions();
+
+    if (UShibaSignificanceManager* Significance = UShibaSignificanceManager::Get(this))
+    {
+        Significance->UnregisterCharacter(this);
+    }
+
     // Cleanup references
     DebugConsole = nullptr;
     CarriedObject = nullptr;
@@ -126,24 +165,41 @@ void AShibaCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void AShibaCharacter::Tick(float DeltaTime)
 {
+    NAUGHTY_PROFILE_SCOPE(Naughty_ShibaTick);
+
     Super::Tick(DeltaTime);
 
+    // Movement-driven mode disables the tick in BeginPlay; guard against it being re-enabled
+    if (!bDriveLogicFromMovement)
+    {
+        UpdateCharacterLogic(GetWorld()->GetTimeSeconds());
+    }
+}
+
+void AShibaCharacter::UpdateCharacterLogic(float TimeSeconds)
+{
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_ShibaCharacterLogic, Character);
+
+    // Fetch movement data once and share it with the state machine
+    const FVector Velocity = GetVelocity();
+    const bool bGrounded = IsGrounded();
+
     // Update character state based on current conditions
-    UpdateCharacterState();
+    EvaluateCharacterState(Velocity, bGrounded);
 
     // Track movement time
-    if (IsMoving())
+    if (Velocity.SizeSquared() > FMath::Square(10.0f))
     {
-        LastMovementTime = GetWorld()->GetTimeSeconds();
+        LastMovementTime = TimeSeconds;
     }
 
     // Cache valid location when grounded
-    if (IsGrounded())
+    if (bGrounded)
     {
         LastValidLocation = GetActorLocation();
         bWasGrounded = true;
     }
-    else if (bWasGrounded && !IsGrounded())
+    else if (bWasGrounded)
     {
         // Just became airborne
         if (CurrentState != EShibaCharacterState::Jumping)
@@ -158,6 +214,12 @@ void AShibaCharacter::PossessedBy(AController* NewController)
 {
     Super::PossessedBy(NewController);
 
+    // Resolve the breed's movement config for the new owner
+    if (GMCMovementComponent)
+    {
+        GMCMovementComponent->ApplyMovementConfig();
+    }
+
     // Initialize input context
     if (InputManager && NewController)
     {
@@ -191,29 +253,56 @@ void AShibaCharacter::SetCharacterState(EShibaCharacterState NewState)
     EShibaCharacterState OldState = CurrentState;
     PreviousState = CurrentState;
     CurrentState = NewState;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AShibaCharacter, CurrentState, this);
 
-    // Call state change handlers
+    // Call state change handlers (replayed moves only redo the bookkeeping, the events already played)
     OnStateChanged(OldState, NewState);
-    OnStateChangedBP(OldState, NewState);
+    if (!IsReplayingMove())
+    {
+        OnStateChangedBP(OldState, NewState);
+    }
 }
 
 void AShibaCharacter::OnStateChanged(EShibaCharacterState OldState, EShibaCharacterState NewState)
 {
+    // Flags are kept in sync on replay; the Blueprint events already fired for the original move
+    const bool bBroadcast = !IsReplayingMove();
+
     // Handle state-specific logic for ENTERING states
     switch (NewState)
     {
         case EShibaCharacterState::Jumping:
-            bIsJumping = true;
-            OnJumped();
+            SetActionFlag(EShibaActionFlags::Jumping, true);
+            if (bBroadcast)
+            {
+                OnJumped();
+            }
             break;
         case EShibaCharacterState::Barking:
-            OnBarked();
+            if (bBroadcast)
+            {
+                OnBarked();
+            }
             break;
         case EShibaCharacterState::Howling:
-            OnHowled();
+            if (bBroadcast)
+            {
+                OnHowled();
+            }
             break;
         case EShibaCharacterState::MarkingTerritory:
-            OnTerritoryMarked();
+            if (bBroadcast)
+            {
+                OnTerritoryMarked();
+            }
+            break;
+        case EShibaCharacterState::Sniffing:
+            // DEBUG: Log when entering Sniffing state
+            if (bBroadcast && IsCosmeticSignificant())
+            {
+                NAUGHTY_DEBUG_MSG(Abilities, FColor::Green, 2.0f, TEXT("[%s] StateMachine: Setting SNIFFING State"),
+                    IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
+            }
             break;
         default:
             break;
@@ -223,19 +312,27 @@ void AShibaCharacter::OnStateChanged(EShibaCharacterState OldState, EShibaCharac
     switch (OldState)
     {
         case EShibaCharacterState::Jumping:
-            bIsJumping = false;  // Reset the flag when leaving JUMPING state
+            SetActionFlag(EShibaActionFlags::Jumping, false);  // Reset the flag when leaving JUMPING state
             
-            if (IsGrounded())
+            if (bBroadcast && IsGrounded())
             {
                 OnLanded();
             }
             break;
         case EShibaCharacterState::Falling:
-            if (IsGrounded())
+            if (bBroadcast && IsGrounded())
             {
                 OnLanded();
             }
             break;
+        case EShibaCharacterState::Sniffing:
+            // DEBUG: Log when leaving Sniffing state
+            if (bBroadcast && IsCosmeticSignificant())
+            {
+                NAUGHTY_DEBUG_MSG(Abilities, FColor::Red, 2.0f, TEXT("[%s] StateMachine: Leaving SNIFFING State"),
+                    IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
+            }
+            break;
         default:
             break;
     }
@@ -308,6 +405,63 @@ UShibaGMCMovement* AShibaCharacter::GetGMCMovementComponent() const
     return GMCMovementComponent;
 }
 
+float AShibaCharacter::GetCurrentMovementSpeed() const
+{
+    return GMCMovementComponent ? GMCMovementComponent->GetCurrentModeSpeed() : BaseMovementSpeed;
+}
+
+void AShibaCharacter::SetLegacySpeedSettings(float NewBaseSpeed, float NewSprintMultiplier, float NewWalkMultiplier, float NewCrouchMultiplier, float NewJumpVelocity)
+{
+    BaseMovementSpeed = NewBaseSpeed;
+    SprintMultiplier = NewSprintMultiplier;
+    WalkMultiplier = NewWalkMultiplier;
+    CrouchMultiplier = NewCrouchMultiplier;
+    JumpVelocity = NewJumpVelocity;
+
+    if (GMCMovementComponent)
+    {
+        GMCMovementComponent->ApplyMovementConfig();
+    }
+}
+
+void AShibaCharacter::SetSignificanceTier(EShibaSignificanceTier NewTier)
+{
+    if (SignificanceTier == NewTier)
+    {
+        return;
+    }
+
+    SignificanceTier = NewTier;
+    const FShibaSignificanceTierSettings& Settings = UShibaSignificanceManager::GetTierSettings(NewTier);
+
+    SetActorTickInterval(Settings.ActorTickInterval);
+
+    if (ShibaMesh)
+    {
+        ShibaMesh->SetComponentTickInterval(Settings.MeshTickInterval);
+    }
+
+    // Predicted/authoritative movement must stay full rate; only smoothing of remote dogs is throttled
+    if (GMCMovementComponent && GetLocalRole() == ROLE_SimulatedProxy)
+    {
+        GMCMovementComponent->SetComponentTickInterval(Settings.SimulatedMovementTickInterval);
+    }
+}
+
+bool AShibaCharacter::IsCosmeticSignificant() const
+{
+#if UE_SERVER
+    return false;
+#else
+    return UShibaSignificanceManager::GetTierSettings(SignificanceTier).bCosmetics;
+#endif
+}
+
+bool AShibaCharacter::IsReplayingMove() const
+{
+    return GMCMovementComponent && GMCMovementComponent->CL_IsReplaying();
+}
+
 // Dog Abilities Implementation
 void AShibaCharacter::StartJump()
 {
@@ -319,13 +473,13 @@ void AShibaCharacter::StartJump()
 
     // Set state FIRST, then set flag
     SetCharacterState(EShibaCharacterState::Jumping);
-    bIsJumping = true;
+    SetActionFlag(EShibaActionFlags::Jumping, true);
     
     // Apply jump physics
     if (GMCMovementComponent)
     {
         FVector CurrentVelocity = GMCMovementComponent->GetVelocity();
-        CurrentVelocity.Z = JumpVelocity;
+        CurrentVelocity.Z = GMCMovementComponent->GetMovementParams().JumpVelocity;
         GMCMovementComponent->SetVelocity(CurrentVelocity);
     }
 }
@@ -345,7 +499,7 @@ void AShibaCharacter::StartSprint()
         return;
     }
 
-    bIsSprinting = true;
+    SetActionFlag(EShibaActionFlags::Sprinting, true);
     SetCharacterState(EShibaCharacterState::Sprinting);
     
     if (GMCMovementComponent)
@@ -356,7 +510,7 @@ void AShibaCharacter::StartSprint()
 
 void AShibaCharacter::StopSprint()
 {
-    bIsSprinting = false;
+    SetActionFlag(EShibaActionFlags::Sprinting, false);
     
     if (GMCMovementComponent)
     {
@@ -371,7 +525,7 @@ void AShibaCharacter::StartCrouch()
         return;
     }
 
-    bIsCrouching = true;
+    SetActionFlag(EShibaActionFlags::Crouching, true);
     SetCharacterState(EShibaCharacterState::Crouching);
 
     if (GMCMovementComponent)
@@ -382,7 +536,7 @@ void AShibaCharacter::StartCrouch()
 
 void AShibaCharacter::StopCrouch()
 {
-    bIsCrouching = false;
+    SetActionFlag(EShibaActionFlags::Crouching, false);
 
     if (GMCMovementComponent)
     {
@@ -392,67 +546,57 @@ void AShibaCharacter::StopCrouch()
 
 void AShibaCharacter::StartBark()
 {
-    // TESTING LOG - Remove after verification
-    FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-    UE_LOG(LogTemp, Warning, TEXT("🔵 [%s] BARK: StartBark() called"), *PlayerType);
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Blue, 2.0f, TEXT("[%s] BARK: StartBark() called"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 
     if (bIsHowling) return; // Can't bark while howling
     
-    bIsBarking = true;
+    SetActionFlag(EShibaActionFlags::Barking, true);
     // UpdateCharacterState() will set the state
     
     // REMOVE THIS LINE - GMC already processed the flag:
     // GMCMovementComponent->SetWantsToBark(true);
     
-    // TESTING LOG - Show state change
-    UE_LOG(LogTemp, Warning, TEXT("🔷 [%s] BARK: bIsBarking set to true"), *PlayerType);
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Blue, 2.0f, TEXT("[%s] BARK: bIsBarking set to true"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 
-    // Auto-stop timer
-    if (UWorld* World = GetWorld())
-    {
-        FTimerHandle TimerHandle;
-        World->GetTimerManager().SetTimer(TimerHandle, this, &AShibaCharacter::StopBark, 1.0f, false);
-    }
+    // Auto-stop (re-barking restarts the timer)
+    ScheduleAction(EShibaActionSlot::Bark, 1.0f);
 }
 
 void AShibaCharacter::StopBark()
 {
-    bIsBarking = false;
+    SetActionFlag(EShibaActionFlags::Barking, false);
 }
 
 void AShibaCharacter::StartHowl()
 {
-    // TESTING LOG - Remove after verification
-    FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-    UE_LOG(LogTemp, Warning, TEXT("🟣 [%s] HOWL: StartHowl() called"), *PlayerType);
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Purple, 2.0f, TEXT("[%s] HOWL: StartHowl() called"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 
     if (bIsBarking) return; // Can't howl while barking
     
-    bIsHowling = true;
+    SetActionFlag(EShibaActionFlags::Howling, true);
     // UpdateCharacterState() will set the state
     
     // REMOVE THIS LINE - GMC already processed the flag:
     // GMCMovementComponent->SetWantsToHowl(true);
     
-    // TESTING LOG - Show state change
-    UE_LOG(LogTemp, Warning, TEXT("🟪 [%s] HOWL: bIsHowling set to true"), *PlayerType);
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Purple, 2.0f, TEXT("[%s] HOWL: bIsHowling set to true"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 
-    // Auto-stop timer
-    if (UWorld* World = GetWorld())
-    {
-        FTimerHandle TimerHandle;
-        World->GetTimerManager().SetTimer(TimerHandle, this, &AShibaCharacter::StopHowl, 3.0f, false);
-    }
+    // Auto-stop (re-howling restarts the timer)
+    ScheduleAction(EShibaActionSlot::Howl, 3.0f);
 }
 
 void AShibaCharacter::StopHowl()
 {
-    bIsHowling = false;
+    SetActionFlag(EShibaActionFlags::Howling, false);
 }
 
 void AShibaCharacter::StartSniffVision()
 {
-    bIsSniffing = true;
+    SetActionFlag(EShibaActionFlags::Sniffing, true);
     // UpdateCharacterState() will set the state
     
     if (GMCMovementComponent)
@@ -460,18 +604,13 @@ void AShibaCharacter::StartSniffVision()
         GMCMovementComponent->SetWantsToSniff(true);
     }
 
-    // TESTING LOG
-    if (GEngine)
-    {
-        FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-        GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Cyan, 
-            FString::Printf(TEXT("🔵 [%s] SNIFF VISION STARTED (Flag Set)"), *PlayerType));
-    }
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Cyan, 3.0f, TEXT("[%s] SNIFF VISION STARTED (Flag Set)"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 }
 
 void AShibaCharacter::StopSniffVision()
 {
-    bIsSniffing = false;
+    SetActionFlag(EShibaActionFlags::Sniffing, false);
     // UpdateCharacterState() will handle state transition
     
     if (GMCMovementComponent)
@@ -479,113 +618,50 @@ void AShibaCharacter::StopSniffVision()
         GMCMovementComponent->SetWantsToSniff(false);
     }
 
-    // TESTING LOG
-    if (GEngine)
-    {
-        FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-        GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange, 
-            FString::Printf(TEXT("🟠 [%s] SNIFF VISION STOPPED (Flag Cleared)"), *PlayerType));
-    }
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Orange, 3.0f, TEXT("[%s] SNIFF VISION STOPPED (Flag Cleared)"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 }
 
 void AShibaCharacter::MarkTerritory()
 {
-    // TESTING LOG - Remove after verification
-    if (GEngine)
-    {
-        FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-        GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange, 
-            FString::Printf(TEXT("🟠 [%s] MARK: MarkTerritory() called"), *PlayerType));
-    }
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Orange, 3.0f, TEXT("[%s] MARK: MarkTerritory() called"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 
     if (!IsGrounded())
     {
-        if (GEngine)
-        {
-            FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-            GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Red, 
-                FString::Printf(TEXT("🔴 [%s] MARK: BLOCKED - Not grounded"), *PlayerType));
-        }
+        NAUGHTY_DEBUG_MSG(Abilities, FColor::Red, 2.0f, TEXT("[%s] MARK: BLOCKED - Not grounded"),
+            IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
         return;
     }
 
     SetCharacterState(EShibaCharacterState::MarkingTerritory);
 
-    // TESTING LOG - Show state change
-    if (GEngine)
-    {
-        FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-        GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Yellow, 
-            FString::Printf(TEXT("🟡 [%s] MARK: State set to MarkingTerritory"), *PlayerType));
-    }
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Yellow, 2.0f, TEXT("[%s] MARK: State set to MarkingTerritory"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 
-    // Auto-return to previous state after marking
-    if (UWorld* World = GetWorld())
-    {
-        FTimerHandle TimerHandle;
-        World->GetTimerManager().SetTimer(TimerHandle, [this]()
-        {
-            SetCharacterState(EShibaCharacterState::Idle);
-            
-            // TESTING LOG - Show state return
-            if (GEngine)
-            {
-                FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-                GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Green, 
-                    FString::Printf(TEXT("🟢 [%s] MARK: Returned to Idle"), *PlayerType));
-            }
-        }, 2.0f, false);
-    }
+    // Auto-return to idle after marking
+    ScheduleAction(EShibaActionSlot::HeldAction, 2.0f);
 }
 
 void AShibaCharacter::Defecate()
 {
-    // TESTING LOG - Remove after verification
-    if (GEngine)
-    {
-        FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-        GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Orange, 
-            FString::Printf(TEXT("🟤 [%s] POOP: Defecate() called"), *PlayerType));
-    }
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Orange, 3.0f, TEXT("[%s] POOP: Defecate() called"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 
     if (!IsGrounded())
     {
-        if (GEngine)
-        {
-            FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-            GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Red, 
-                FString::Printf(TEXT("🔴 [%s] POOP: BLOCKED - Not grounded"), *PlayerType));
-        }
+        NAUGHTY_DEBUG_MSG(Abilities, FColor::Red, 2.0f, TEXT("[%s] POOP: BLOCKED - Not grounded"),
+            IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
         return;
     }
 
     SetCharacterState(EShibaCharacterState::Defecating);
 
-    // TESTING LOG - Show state change
-    if (GEngine)
-    {
-        FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-        GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Orange, 
-            FString::Printf(TEXT("🟠 [%s] POOP: State set to Defecating"), *PlayerType));
-    }
+    NAUGHTY_DEBUG_MSG(Abilities, FColor::Orange, 2.0f, TEXT("[%s] POOP: State set to Defecating"),
+        IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
 
-    // Auto-return to previous state after action
-    if (UWorld* World = GetWorld())
-    {
-        FTimerHandle TimerHandle;
-        World->GetTimerManager().SetTimer(TimerHandle, [this]()
-        {
-            SetCharacterState(EShibaCharacterState::Idle);
-            
-            // TESTING LOG - Show state return
-            if (GEngine)
-            {
-                FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-                GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Green, 
-                    FString::Printf(TEXT("🟢 [%s] POOP: Returned to Idle"), *PlayerType));
-            }
-        }, 3.0f, false);
-    }
+    // Auto-return to idle after action
+    ScheduleAction(EShibaActionSlot::HeldAction, 3.0f);
 }
 
 void AShibaCharacter::StartPickUp()
@@ -596,8 +672,7 @@ void AShibaCharacter::StartPickUp()
         if (CarriedObject)
         {
             OnObjectReleased(CarriedObject);
-            CarriedObject = nullptr;
-            bIsCarryingObject = false;
+            SetCarriedObject(nullptr);
         }
         return;
     }
@@ -605,14 +680,7 @@ void AShibaCharacter::StartPickUp()
     SetCharacterState(EShibaCharacterState::PickingUp);
 
     // Auto-return to idle after pickup attempt
-    if (UWorld* World = GetWorld())
-    {
-        FTimerHandle TimerHandle;
-        World->GetTimerManager().SetTimer(TimerHandle, [this]()
-        {
-            SetCharacterState(EShibaCharacterState::Idle);
-        }, 1.5f, false);
-    }
+    ScheduleAction(EShibaActionSlot::HeldAction, 1.5f);
 }
 
 void AShibaCharacter::Interact()
@@ -640,142 +708,116 @@ void AShibaCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    // Replicate character state
-    DOREPLIFETIME(AShibaCharacter, CurrentState);
-    DOREPLIFETIME(AShibaCharacter, bIsJumping);
-    DOREPLIFETIME(AShibaCharacter, bIsSprinting);
-    DOREPLIFETIME(AShibaCharacter, bIsWalking);
-    DOREPLIFETIME(AShibaCharacter, bIsCrouching);
-    DOREPLIFETIME(AShibaCharacter, bIsBarking);
-    DOREPLIFETIME(AShibaCharacter, bIsHowling);
-    DOREPLIFETIME(AShibaCharacter, bIsSniffing);
-    DOREPLIFETIME(AShibaCharacter, bIsCarryingObject);
-    DOREPLIFETIME(AShibaCharacter, CarriedObject);
+    // Push-model: properties are only compared after being marked dirty
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(AShibaCharacter, CurrentState, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AShibaCharacter, ActionFlags, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(AShibaCharacter, CarriedObject, Params);
 }
 
-// Helper Functions
-void AShibaCharacter::UpdateCharacterState()
+void AShibaCharacter::OnRep_ActionFlags()
 {
-    // PRIORITY 1: Death (always wins)
-    /*if (/* death condition #1#)
-    {
-        SetCharacterState(EShibaCharacterState::Dead);
-        return;
-    }*/
-
-    // PRIORITY 2: Airborne States (physics-driven, can't be overridden)
-    if (CurrentState == EShibaCharacterState::Jumping)
-    {
-        // Only allow JUMPING → FALLING based on velocity
-        if (GetVelocity().Z <= 0.0f)
-        {
-            SetCharacterState(EShibaCharacterState::Falling);
-        }
-        return; // Don't check other states while jumping
-    }
-    
-    if (CurrentState == EShibaCharacterState::Falling)
-    {
-        if (IsGrounded())
-        {
-            // Fall back to grounded state logic below
-        }
-        else
-        {
-            return; // Still falling, don't change state
-        }
-    }
+    ApplyActionFlags();
+}
 
-    // PRIORITY 3: Environmental States (external conditions)
-    if (IsSwimming())
+void AShibaCharacter::SetActionFlag(EShibaActionFlags Flag, bool bEnabled)
+{
+    const uint8 NewFlags = bEnabled ? (ActionFlags | static_cast<uint8>(Flag)) : (ActionFlags & ~static_cast<uint8>(Flag));
+    if (NewFlags == ActionFlags)
     {
-        SetCharacterState(EShibaCharacterState::Swimming);
         return;
     }
 
-    // PRIORITY 4: Action States (mutually exclusive abilities)
-    // These are one-time actions that interrupt movement
-    if (bIsBarking)
-    {
-        SetCharacterState(EShibaCharacterState::Barking);
-        return;
-    }
-    
-    if (bIsHowling)
+    ActionFlags = NewFlags;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AShibaCharacter, ActionFlags, this);
+    ApplyActionFlags();
+}
+
+void AShibaCharacter::ApplyActionFlags()
+{
+    const EShibaActionFlags Flags = static_cast<EShibaActionFlags>(ActionFlags);
+
+    bIsJumping = EnumHasAnyFlags(Flags, EShibaActionFlags::Jumping);
+    bIsSprinting = EnumHasAnyFlags(Flags, EShibaActionFlags::Sprinting);
+    bIsWalking = EnumHasAnyFlags(Flags, EShibaActionFlags::Walking);
+    bIsCrouching = EnumHasAnyFlags(Flags, EShibaActionFlags::Crouching);
+    bIsBarking = EnumHasAnyFlags(Flags, EShibaActionFlags::Barking);
+    bIsHowling = EnumHasAnyFlags(Flags, EShibaActionFlags::Howling);
+    bIsSniffing = EnumHasAnyFlags(Flags, EShibaActionFlags::Sniffing);
+    bIsCarryingObject = EnumHasAnyFlags(Flags, EShibaActionFlags::CarryingObject);
+}
+
+void AShibaCharacter::SetCarriedObject(AActor* NewCarriedObject)
+{
+    if (CarriedObject != NewCarriedObject)
     {
-        SetCharacterState(EShibaCharacterState::Howling);
-        return;
+        CarriedObject = NewCarriedObject;
+        MARK_PROPERTY_DIRTY_FROM_NAME(AShibaCharacter, CarriedObject, this);
     }
-    
-    if (CurrentState == EShibaCharacterState::MarkingTerritory ||
-        CurrentState == EShibaCharacterState::Defecating ||
-        CurrentState == EShibaCharacterState::PickingUp ||
-        CurrentState == EShibaCharacterState::Digging)
+
+    SetActionFlag(EShibaActionFlags::CarryingObject, NewCarriedObject != nullptr);
+}
+
+// Helper Functions
+void AShibaCharacter::UpdateCharacterState()
+{
+    EvaluateCharacterState(GetVelocity(), IsGrounded());
+}
+
+void AShibaCharacter::EvaluateCharacterState(const FVector& Velocity, bool bGrounded)
+{
+    const EShibaStateCondition Conditions = GetStateConditions(Velocity, bGrounded);
+    const EShibaSpeedBand SpeedBand = GetSpeedBand(Velocity.Size());
+
+    // Only re-run the table when the state, a flag or the speed band actually changed
+    const uint32 EvaluationKey = FShibaStateMachine::MakeEvaluationKey(CurrentState, Conditions, SpeedBand);
+    if (EvaluationKey == LastStateEvaluationKey)
     {
-        // These are timer-based states, don't override them
         return;
     }
+    LastStateEvaluationKey = EvaluationKey;
 
-    // PRIORITY 5: Persistent Modifier States (can combine with movement)
-    bool bHasModifier = false;
-    
-    if (bIsSniffing)
-    {
-        // DEBUG: Log when UpdateCharacterState sets Sniffing state
-        if (CurrentState != EShibaCharacterState::Sniffing && GEngine)
-        {
-            FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-            GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Green, 
-                FString::Printf(TEXT("🟢 [%s] UpdateCharacterState: Setting SNIFFING State"), *PlayerType));
-        }
-        
-        SetCharacterState(EShibaCharacterState::Sniffing);
-        bHasModifier = true;
-    }
-    else if (CurrentState == EShibaCharacterState::Sniffing)
-    {
-        // DEBUG: Log when leaving Sniffing state
-        if (GEngine)
-        {
-            FString PlayerType = IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-            GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Red, 
-                FString::Printf(TEXT("🔴 [%s] UpdateCharacterState: Leaving SNIFFING State"), *PlayerType));
-        }
-    }
-    
-    if (bIsCrouching)
+    const EShibaCharacterState TargetState = FShibaStateMachine::Resolve(CurrentState, Conditions, SpeedBand);
+    if (TargetState != CurrentState)
     {
-        SetCharacterState(EShibaCharacterState::Crouching);
-        bHasModifier = true;
+        SetCharacterState(TargetState);
     }
-    
-    if (bHasModifier)
+}
+
+EShibaStateCondition AShibaCharacter::GetStateConditions(const FVector& Velocity, bool bGrounded) const
+{
+    EShibaStateCondition Conditions = EShibaStateCondition::None;
+
+    if (bGrounded)      Conditions |= EShibaStateCondition::Grounded;
+    if (IsSwimming())   Conditions |= EShibaStateCondition::Swimming;
+    if (Velocity.Z <= 0.0f) Conditions |= EShibaStateCondition::Descending;
+    if (bIsBarking)     Conditions |= EShibaStateCondition::Barking;
+    if (bIsHowling)     Conditions |= EShibaStateCondition::Howling;
+    if (bIsSniffing)    Conditions |= EShibaStateCondition::Sniffing;
+    if (bIsCrouching)   Conditions |= EShibaStateCondition::Crouching;
+    if (bIsSprinting)   Conditions |= EShibaStateCondition::Sprinting;
+
+    return Conditions;
+}
+
+EShibaSpeedBand AShibaCharacter::GetSpeedBand(float Speed) const
+{
+    // Same threshold as IsMoving()
+    if (Speed <= 10.0f)
     {
-        return; // Don't override modifier states with movement states
+        return EShibaSpeedBand::Stationary;
     }
-
-    // PRIORITY 6: Movement States (lowest priority, based on speed)
-    if (IsGrounded() && IsMoving())
+    if (Speed >= SprintThreshold)
     {
-        float CurrentSpeed = GetCurrentSpeed();
-        
-        if (bIsSprinting && CurrentSpeed >= SprintThreshold)
-        {
-            SetCharacterState(EShibaCharacterState::Sprinting);
-        }
-        else if (CurrentSpeed >= RunThreshold)
-        {
-            SetCharacterState(EShibaCharacterState::Running);
-        }
-        else
-        {
-            SetCharacterState(EShibaCharacterState::Walking);
-        }
+        return EShibaSpeedBand::Sprint;
     }
-    else if (IsGrounded())
+    if (Speed >= RunThreshold)
     {
-        SetCharacterState(EShibaCharacterState::Idle);
+        return EShibaSpeedBand::Run;
     }
+    return EShibaSpeedBand::Walk;
 }
 
 bool AShibaCharacter::IsAnyActionActive() const
@@ -791,6 +833,8 @@ bool AShibaCharacter::IsAnyActionActive() const
 
 void AShibaCharacter::CancelAllActions()
 {
+    CancelScheduledActions();
+
     if (bIsBarking) StopBark();
     if (bIsHowling) StopHowl();
     if (bIsSniffing) StopSniffVision();
@@ -798,6 +842,61 @@ void AShibaCharacter::CancelAllActions()
     if (bIsCrouching) StopCrouch();
 }
 
+void AShibaCharacter::ScheduleAction(EShibaActionSlot Slot, float Duration)
+{
+    UShibaActionScheduler* Scheduler = UShibaActionScheduler::Get(this);
+    if (!Scheduler)
+    {
+        return;
+    }
+
+    // Inside a predicted move the expiry is anchored to the move, not to when it happens to be (re)simulated
+    const UShibaGMCMovement* Movement = GMCMovementComponent;
+    if (Movement && Movement->bInPredictedMove)
+    {
+        Scheduler->ScheduleFromMove(this, Slot, Duration, Movement->GetMoveTimestamp(), Movement->CL_IsReplaying());
+    }
+    else
+    {
+        Scheduler->Schedule(this, Slot, Duration);
+    }
+}
+
+void AShibaCharacter::CancelScheduledActions()
+{
+    if (UShibaActionScheduler* Scheduler = UShibaActionScheduler::Get(this))
+    {
+        Scheduler->CancelAll(this);
+    }
+}
+
+void AShibaCharacter::OnScheduledActionExpired(EShibaActionSlot Slot)
+{
+    switch (Slot)
+    {
+        case EShibaActionSlot::Bark:
+            StopBark();
+            break;
+
+        case EShibaActionSlot::Howl:
+            StopHowl();
+            break;
+
+        case EShibaActionSlot::HeldAction:
+            SetCharacterState(EShibaCharacterState::Idle);
+
+            if (IsCosmeticSignificant())
+            {
+                NAUGHTY_DEBUG_MSG(Abilities, FColor::Green, 2.0f, TEXT("[%s] ACTION: Returned to Idle"),
+                    IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
 // Input Event Handlers
 void AShibaCharacter::HandleMoveInput(FVector2D MoveVector)
 {
@@ -849,8 +948,7 @@ void AShibaCharacter::HandleCrouchReleased()
 
 void AShibaCharacter::HandleBarkPressed()
 {
-    // TESTING LOG - Input detection  
-    UE_LOG(LogTemp, Warning, TEXT("⌨️ INPUT: B key (Bark) pressed - Setting GMC flag only"));
+    NAUGHTY_DEBUG_MSG(Input, FColor::White, 1.0f, TEXT("INPUT: B key (Bark) pressed - Setting GMC flag only"));
     
     // ONLY set GMC flag - let GMC handle calling StartBark()
     if (GMCMovementComponent)
@@ -889,8 +987,7 @@ void AShibaCharacter::HandleSniffVisionReleased()
 
 void AShibaCharacter::HandleHowlPressed()
 {
-    // TESTING LOG - Input detection
-    UE_LOG(LogTemp, Warning, TEXT("⌨️ INPUT: H key (Howl) pressed - Setting GMC flag only"));
+    NAUGHTY_DEBUG_MSG(Input, FColor::White, 1.0f, TEXT("INPUT: H key (Howl) pressed - Setting GMC flag only"));
     
     // ONLY set GMC flag - let GMC handle calling StartHowl()
     if (GMCMovementComponent)
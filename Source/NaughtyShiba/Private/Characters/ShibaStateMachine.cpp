@@ -0,0 +1,147 @@
+#include "Characters/ShibaStateMachine.h"
+#include "Containers/StaticArray.h"
+
+namespace ShibaStateMachine
+{
+    // States that behave differently in the rules; every other state is "Free"
+    enum class EStateClass : uint8
+    {
+        Free    = 0,
+        Jumping = 1,
+        Falling = 2,
+        Held    = 3     // Timer-driven actions (marking, defecating, picking up, digging)
+    };
+
+    // Sentinel stored in the table when the current state should be kept
+    static constexpr uint8 KeepState = 0xFF;
+
+    // Table layout: [StateClass:2][Conditions:8][SpeedBand:2]
+    static constexpr int32 TableSize = 4 << 10;
+
+    static EStateClass GetStateClass(EShibaCharacterState State)
+    {
+        switch (State)
+        {
+            case EShibaCharacterState::Jumping:
+                return EStateClass::Jumping;
+            case EShibaCharacterState::Falling:
+                return EStateClass::Falling;
+            case EShibaCharacterState::MarkingTerritory:
+            case EShibaCharacterState::Defecating:
+            case EShibaCharacterState::PickingUp:
+            case EShibaCharacterState::Digging:
+                return EStateClass::Held;
+            default:
+                return EStateClass::Free;
+        }
+    }
+
+    static int32 MakeTableIndex(EStateClass StateClass, EShibaStateCondition Conditions, EShibaSpeedBand SpeedBand)
+    {
+        return (static_cast<int32>(StateClass) << 10)
+            | (static_cast<int32>(Conditions) << 2)
+            | static_cast<int32>(SpeedBand);
+    }
+
+    // Transition rules in priority order - this is the only place the rules live
+    static uint8 EvaluateRules(EStateClass StateClass, EShibaStateCondition Conditions, EShibaSpeedBand SpeedBand)
+    {
+        auto Has = [Conditions](EShibaStateCondition Flag) { return EnumHasAnyFlags(Conditions, Flag); };
+        auto To = [](EShibaCharacterState State) { return static_cast<uint8>(State); };
+
+        // PRIORITY 1: Airborne states (physics-driven, can't be overridden)
+        if (StateClass == EStateClass::Jumping)
+        {
+            // Only allow JUMPING -> FALLING based on velocity
+            return Has(EShibaStateCondition::Descending) ? To(EShibaCharacterState::Falling) : KeepState;
+        }
+
+        if (StateClass == EStateClass::Falling && !Has(EShibaStateCondition::Grounded))
+        {
+            return KeepState; // Still falling
+        }
+
+        // PRIORITY 2: Environmental states
+        if (Has(EShibaStateCondition::Swimming))
+        {
+            return To(EShibaCharacterState::Swimming);
+        }
+
+        // PRIORITY 3: Action states (mutually exclusive abilities)
+        if (Has(EShibaStateCondition::Barking))
+        {
+            return To(EShibaCharacterState::Barking);
+        }
+
+        if (Has(EShibaStateCondition::Howling))
+        {
+            return To(EShibaCharacterState::Howling);
+        }
+
+        if (StateClass == EStateClass::Held)
+        {
+            return KeepState; // Timer-based states end themselves
+        }
+
+        // PRIORITY 4: Persistent modifier states (crouch wins over sniff)
+        if (Has(EShibaStateCondition::Crouching))
+        {
+            return To(EShibaCharacterState::Crouching);
+        }
+
+        if (Has(EShibaStateCondition::Sniffing))
+        {
+            return To(EShibaCharacterState::Sniffing);
+        }
+
+        // PRIORITY 5: Movement states (lowest priority, based on speed band)
+        if (!Has(EShibaStateCondition::Grounded))
+        {
+            return KeepState;
+        }
+
+        switch (SpeedBand)
+        {
+            case EShibaSpeedBand::Sprint:
+                return Has(EShibaStateCondition::Sprinting) ? To(EShibaCharacterState::Sprinting) : To(EShibaCharacterState::Running);
+            case EShibaSpeedBand::Run:
+                return To(EShibaCharacterState::Running);
+            case EShibaSpeedBand::Walk:
+                return To(EShibaCharacterState::Walking);
+            default:
+                return To(EShibaCharacterState::Idle);
+        }
+    }
+
+    static const TStaticArray<uint8, TableSize>& GetTransitionTable()
+    {
+        static const TStaticArray<uint8, TableSize> Table = []()
+        {
+            TStaticArray<uint8, TableSize> Result;
+            for (uint8 StateClass = 0; StateClass < 4; ++StateClass)
+            {
+                for (int32 Conditions = 0; Conditions <= 0xFF; ++Conditions)
+                {
+                    for (uint8 SpeedBand = 0; SpeedBand < 4; ++SpeedBand)
+                    {
+                        const EStateClass Class = static_cast<EStateClass>(StateClass);
+                        const EShibaStateCondition Flags = static_cast<EShibaStateCondition>(Conditions);
+                        const EShibaSpeedBand Band = static_cast<EShibaSpeedBand>(SpeedBand);
+                        Result[MakeTableIndex(Class, Flags, Band)] = EvaluateRules(Class, Flags, Band);
+                    }
+                }
+            }
+            return Result;
+        }();
+
+        return Table;
+    }
+}
+
+EShibaCharacterState FShibaStateMachine::Resolve(EShibaCharacterState CurrentState, EShibaStateCondition Conditions, EShibaSpeedBand SpeedBand)
+{
+    using namespace ShibaStateMachine;
+
+    const uint8 Target = GetTransitionTable()[MakeTableIndex(GetStateClass(CurrentState), Conditions, SpeedBand)];
+    return Target == KeepState ? CurrentState : static_cast<EShibaCharacterState>(Target);
+}
@@ -1,5 +1,6 @@
 #include "Components/InputManagerComponent.h"
 #include "Systems/DebugConsole.h"
+#include "Systems/NaughtyDebugChannels.h"
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/LocalPlayer.h"
@@ -165,6 +166,52 @@ void UInputManagerComponent::DisableInput(APlayerController* PlayerController)
     }
 }
 
+void UInputManagerComponent::InjectMoveInput(FVector2D MoveVector)
+{
+    HandleMoveInput(FInputActionValue(MoveVector));
+}
+
+void UInputManagerComponent::InjectAction(EShibaInputAction Action, bool bPressed)
+{
+    const FInputActionValue Value(bPressed);
+
+    switch (Action)
+    {
+        case EShibaInputAction::Jump:
+            bPressed ? HandleJumpPressed(Value) : HandleJumpReleased(Value);
+            break;
+        case EShibaInputAction::Sprint:
+            bPressed ? HandleSprintPressed(Value) : HandleSprintReleased(Value);
+            break;
+        case EShibaInputAction::Crouch:
+            bPressed ? HandleCrouchPressed(Value) : HandleCrouchReleased(Value);
+            break;
+        case EShibaInputAction::Bark:
+            bPressed ? HandleBarkPressed(Value) : HandleBarkReleased(Value);
+            break;
+        case EShibaInputAction::Howl:
+            bPressed ? HandleHowlPressed(Value) : HandleHowlReleased(Value);
+            break;
+        case EShibaInputAction::SniffVision:
+            bPressed ? HandleSniffVisionPressed(Value) : HandleSniffVisionReleased(Value);
+            break;
+        case EShibaInputAction::PickUp:
+            bPressed ? HandlePickUpPressed(Value) : HandlePickUpReleased(Value);
+            break;
+        case EShibaInputAction::MarkTerritory:
+            if (bPressed) HandleMarkTerritoryPressed(Value);
+            break;
+        case EShibaInputAction::Defecate:
+            if (bPressed) HandleDefecatePressed(Value);
+            break;
+        case EShibaInputAction::Interact:
+            if (bPressed) HandleInteractPressed(Value);
+            break;
+        default:
+            break;
+    }
+}
+
 // Input handler implementations
 void UInputManagerComponent::HandleMoveInput(const FInputActionValue& Value)
 {
@@ -216,8 +263,7 @@ void UInputManagerComponent::HandleCrouchReleased(const FInputActionValue& Value
 
 void UInputManagerComponent::HandleBarkPressed(const FInputActionValue& Value)
 {
-    // TESTING LOG - Input detection
-    UE_LOG(LogTemp, Warning, TEXT("⌨️ INPUT: B key (Bark) pressed"));
+    NAUGHTY_DEBUG_MSG(Input, FColor::White, 1.0f, TEXT("INPUT: B key (Bark) pressed"));
     
     OnBarkPressed.Broadcast();
 }
@@ -236,12 +282,7 @@ void UInputManagerComponent::HandleInteractPressed(const FInputActionValue& Valu
 
 void UInputManagerComponent::HandleMarkTerritoryPressed(const FInputActionValue& Value)
 {
-    // TESTING LOG - Input detection
-    if (GEngine)
-    {
-        GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, 
-            TEXT("⌨️ INPUT: T key (Mark Territory) pressed"));
-    }
+    NAUGHTY_DEBUG_MSG(Input, FColor::White, 1.0f, TEXT("INPUT: T key (Mark Territory) pressed"));
     
     OnMarkTerritoryPressed.Broadcast();
 }
@@ -272,8 +313,7 @@ void UInputManagerComponent::HandleSniffVisionReleased(const FInputActionValue&
 
 void UInputManagerComponent::HandleHowlPressed(const FInputActionValue& Value)
 {
-    // TESTING LOG - Input detection
-    UE_LOG(LogTemp, Warning, TEXT("⌨️ INPUT: H key (Howl) pressed"));
+    NAUGHTY_DEBUG_MSG(Input, FColor::White, 1.0f, TEXT("INPUT: H key (Howl) pressed"));
     
     bHowlPressed = true;
     OnHowlPressed.Broadcast();
@@ -287,12 +327,7 @@ void UInputManagerComponent::HandleHowlReleased(const FInputActionValue& Value)
 
 void UInputManagerComponent::HandleDefecatePressed(const FInputActionValue& Value)
 {
-    // TESTING LOG - Input detection
-    if (GEngine)
-    {
-        GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, 
-            TEXT("⌨️ INPUT: Y key (Defecate) pressed"));
-    }
+    NAUGHTY_DEBUG_MSG(Input, FColor::White, 1.0f, TEXT("INPUT: Y key (Defecate) pressed"));
     
     OnDefecatePressed.Broadcast();
 }
\ No newline at end of file
@@ -53,4 +53,17 @@ void ANaughtyPlayerController::OpenDebugConsole()
 	{
 		DebugConsole->LogInfo(TEXT("Debug console opened via Player Controller"));
 	}
-}
\ No newline at end of file
+}
+
+void ANaughtyPlayerController::ServerReportMovementStats_Implementation(int32 NumReplays, int32 NumMoves)
+{
+	// Unreliable and cumulative, so a dropped report just folds into the next one.
+	// A counter below the last report means the client's counters restarted (respawn, component reset),
+	// so everything it reports now is new
+	const bool bCountersRestarted = NumMoves < LastClientMoves || NumReplays < LastClientReplays;
+	ReportedReplays += bCountersRestarted ? NumReplays : NumReplays - LastClientReplays;
+	ReportedMoves += bCountersRestarted ? NumMoves : NumMoves - LastClientMoves;
+
+	LastClientReplays = NumReplays;
+	LastClientMoves = NumMoves;
+}
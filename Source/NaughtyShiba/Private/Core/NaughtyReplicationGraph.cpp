@@ -0,0 +1,220 @@
+#include "Core/NaughtyReplicationGraph.h"
+#include "NaughtyShiba.h"
+#include "Characters/ShibaCharacter.h"
+#include "Core/NaughtyGameState.h"
+#include "ReplicationGraphTypes.h"
+#include "Engine/LevelScriptActor.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/PlayerState.h"
+
+void UNaughtyReplicationGraph::InitGlobalActorClassSettings()
+{
+    Super::InitGlobalActorClassSettings();
+
+    // Explicit routes; ANaughtyGameState is listed on purpose even though its parent already covers it
+    ClassRepNodePolicies.Set(AShibaCharacter::StaticClass(), ENaughtyRepNodeMapping::Spatialize_Dynamic);
+    ClassRepNodePolicies.Set(ANaughtyGameState::StaticClass(), ENaughtyRepNodeMapping::RelevantAllConnections);
+    ClassRepNodePolicies.Set(AGameStateBase::StaticClass(), ENaughtyRepNodeMapping::RelevantAllConnections);
+    ClassRepNodePolicies.Set(APlayerState::StaticClass(), ENaughtyRepNodeMapping::RelevantAllConnections);
+    ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), ENaughtyRepNodeMapping::NotRouted);
+    ClassRepNodePolicies.Set(AReplicationGraphDebugActor::StaticClass(), ENaughtyRepNodeMapping::NotRouted);
+
+    // Class settings are built lazily, including for Blueprint classes loaded after the graph starts
+    GlobalActorReplicationInfoMap.SetInitClassInfoFunc(
+        [this](UClass* Class, FClassReplicationInfo& ClassInfo)
+        {
+            InitClassReplicationInfo(ClassInfo, Class, IsSpatialized(GetMappingPolicy(Class)));
+            return true;
+        });
+}
+
+void UNaughtyReplicationGraph::InitGlobalGraphNodes()
+{
+    // Pawns, props and markers
+    GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+    GridNode->CellSize = GridCellSize;
+    GridNode->SpatialBias = GridSpatialBias;
+
+    if (bDisableSpatialRebuilds)
+    {
+        GridNode->AddToClassRebuildDenyList(AActor::StaticClass());
+    }
+
+    AddGlobalGraphNode(GridNode);
+
+    // Game state and player states
+    AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+    AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+void UNaughtyReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+    Super::InitConnectionGraphNodes(RepGraphConnection);
+
+    // Controllers and other owner-only actors
+    UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+    AddConnectionGraphNode(Node, RepGraphConnection);
+
+    AlwaysRelevantForConnection.Add(RepGraphConnection->NetConnection, Node);
+}
+
+void UNaughtyReplicationGraph::OnRemoveConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+    AlwaysRelevantForConnection.Remove(RepGraphConnection->NetConnection);
+}
+
+void UNaughtyReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+        case ENaughtyRepNodeMapping::RelevantAllConnections:
+            AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+            break;
+
+        case ENaughtyRepNodeMapping::OwnerOnly:
+            // Owner may not have a connection yet; PrepareForReplication picks it up once it does
+            ActorsWithoutNetConnection.Add(ActorInfo.Actor);
+            break;
+
+        case ENaughtyRepNodeMapping::Spatialize_Static:
+            GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+            break;
+
+        case ENaughtyRepNodeMapping::Spatialize_Dynamic:
+            GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+            break;
+
+        case ENaughtyRepNodeMapping::Spatialize_Dormancy:
+            GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void UNaughtyReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+        case ENaughtyRepNodeMapping::RelevantAllConnections:
+            AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+            break;
+
+        case ENaughtyRepNodeMapping::OwnerOnly:
+            if (UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = GetAlwaysRelevantNodeForConnection(ActorInfo.Actor->GetNetConnection()))
+            {
+                Node->NotifyRemoveNetworkActor(ActorInfo);
+            }
+            ActorsWithoutNetConnection.RemoveSwap(ActorInfo.Actor);
+            break;
+
+        case ENaughtyRepNodeMapping::Spatialize_Static:
+            GridNode->RemoveActor_Static(ActorInfo);
+            break;
+
+        case ENaughtyRepNodeMapping::Spatialize_Dynamic:
+            GridNode->RemoveActor_Dynamic(ActorInfo);
+            break;
+
+        case ENaughtyRepNodeMapping::Spatialize_Dormancy:
+            GridNode->RemoveActor_Dormancy(ActorInfo);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void UNaughtyReplicationGraph::PrepareForReplication()
+{
+    Super::PrepareForReplication();
+
+    // Hand owner-only actors to their connection once they have one
+    for (int32 Index = ActorsWithoutNetConnection.Num() - 1; Index >= 0; --Index)
+    {
+        bool bRemove = true;
+        if (AActor* Actor = ActorsWithoutNetConnection[Index])
+        {
+            if (UNetConnection* Connection = Actor->GetNetConnection())
+            {
+                if (UReplicationGraphNode_AlwaysRelevant_ForConnection* Node = GetAlwaysRelevantNodeForConnection(Connection))
+                {
+                    Node->NotifyAddNetworkActor(FNewReplicatedActorInfo(Actor));
+                }
+            }
+            else
+            {
+                bRemove = false;
+            }
+        }
+
+        if (bRemove)
+        {
+            ActorsWithoutNetConnection.RemoveAtSwap(Index, 1, false);
+        }
+    }
+}
+
+ENaughtyRepNodeMapping UNaughtyReplicationGraph::GetMappingPolicy(UClass* Class)
+{
+    if (const ENaughtyRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+    {
+        return *Policy;
+    }
+
+    // Not listed - derive the route from the class defaults and remember it
+    ENaughtyRepNodeMapping Policy = ENaughtyRepNodeMapping::Spatialize_Dynamic;
+    const AActor* ActorCDO = Class ? Cast<AActor>(Class->GetDefaultObject()) : nullptr;
+
+    if (!ActorCDO || !ActorCDO->GetIsReplicated())
+    {
+        Policy = ENaughtyRepNodeMapping::NotRouted;
+    }
+    else if (ActorCDO->bAlwaysRelevant)
+    {
+        Policy = ENaughtyRepNodeMapping::RelevantAllConnections;
+    }
+    else if (ActorCDO->bOnlyRelevantToOwner)
+    {
+        Policy = ENaughtyRepNodeMapping::OwnerOnly;
+    }
+    else if (ActorCDO->NetDormancy >= DORM_DormantAll)
+    {
+        Policy = ENaughtyRepNodeMapping::Spatialize_Dormancy;
+    }
+    else if (ActorCDO->GetRootComponent() && ActorCDO->GetRootComponent()->Mobility == EComponentMobility::Static)
+    {
+        Policy = ENaughtyRepNodeMapping::Spatialize_Static;
+    }
+
+    ClassRepNodePolicies.Set(Class, Policy);
+    return Policy;
+}
+
+void UNaughtyReplicationGraph::InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const
+{
+    const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+    if (!ActorCDO)
+    {
+        return;
+    }
+
+    // Keep the per-actor tuning (NetCullDistanceSquared, NetUpdateFrequency) meaningful under the graph
+    if (bSpatialize)
+    {
+        Info.SetCullDistanceSquared(ActorCDO->NetCullDistanceSquared);
+    }
+    Info.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(ActorCDO->NetUpdateFrequency);
+}
+
+UReplicationGraphNode_AlwaysRelevant_ForConnection* UNaughtyReplicationGraph::GetAlwaysRelevantNodeForConnection(UNetConnection* Connection) const
+{
+    if (!Connection)
+    {
+        return nullptr;
+    }
+
+    UReplicationGraphNode_AlwaysRelevant_ForConnection* const* Node = AlwaysRelevantForConnection.Find(Connection);
+    return Node ? *Node : nullptr;
+}
@@ -2,7 +2,14 @@
 #include "Components/InputManagerComponent.h" 
 #include "Characters/ShibaCharacter.h"
 #include "Systems/DebugConsole.h"
+#include "Movement/ShibaMovementConfig.h"
+#include "Systems/NaughtyProfiler.h"
+#include "Systems/NaughtyDebugChannels.h"
+#include "Systems/ShibaSignificanceManager.h"
 #include "Engine/World.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "GameFramework/PlayerState.h"
+#include "Engine/NetConnection.h"
 
 UShibaGMCMovement::UShibaGMCMovement()
 {
@@ -13,12 +20,8 @@ UShibaGMCMovement::UShibaGMCMovement()
     MaxDesiredSpeed = 400.0f;
     
     // Reset input flags
-    bWantsToJump = false;
-    bWantsToSprint = false;
-    bWantsToCrouch = false;
-    bWantsToBark = false;
-    bWantsToSniff = false;
-    bWantsToHowl = false;
+    InputFlags = 0;
+    InputEdgeFlags = 0;
     
     // Initialize references
     CachedInputManager = nullptr;
@@ -29,6 +32,92 @@ UShibaGMCMovement::UShibaGMCMovement()
     bWasMovingLastFrame = false;
 }
 
+void UShibaGMCMovement::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Config is assigned on the Blueprint, so it can only be flattened once defaults are applied
+    ApplyMovementConfig();
+
+    Stamina = GetMaxStamina();
+    bStaminaExhausted = false;
+
+#if WITH_EDITOR
+    // Re-flatten when the asset is tweaked during PIE
+    ConfigChangedHandle = UShibaMovementConfig::OnMovementConfigChanged.AddUObject(this, &UShibaGMCMovement::HandleMovementConfigChanged);
+#endif
+}
+
+void UShibaGMCMovement::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+#if WITH_EDITOR
+    UShibaMovementConfig::OnMovementConfigChanged.Remove(ConfigChangedHandle);
+#endif
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UShibaGMCMovement::ApplyMovementConfig()
+{
+    MovementParams = FShibaMovementParams();
+
+    if (MovementConfig)
+    {
+        MovementConfig->FlattenInto(MovementParams);
+    }
+    else if (const AShibaCharacter* ShibaChar = GetShibaCharacter())
+    {
+        // No asset - keep the character's hand-tuned speeds (special modes move at base speed)
+        const float Base = ShibaChar->BaseMovementSpeed;
+        for (float& Speed : MovementParams.SpeedTable)
+        {
+            Speed = Base;
+        }
+        MovementParams.SpeedTable[(int32)EShibaSpeedMode::Crouch] = Base * ShibaChar->CrouchMultiplier;
+        MovementParams.SpeedTable[(int32)EShibaSpeedMode::Sprint] = Base * ShibaChar->SprintMultiplier;
+        MovementParams.SpeedTable[(int32)EShibaSpeedMode::Walk] = Base * ShibaChar->WalkMultiplier;
+        MovementParams.JumpVelocity = ShibaChar->JumpVelocity;
+    }
+
+    // Multipliers may have changed under the cached floor
+    CachedFloorComponent.Reset();
+    CachedFloorMaterial.Reset();
+    CachedSurfaceMultiplier = 1.0f;
+
+    Stamina = FMath::Min(Stamina, MovementParams.MaxStamina);
+}
+
+#if WITH_EDITOR
+void UShibaGMCMovement::HandleMovementConfigChanged(const UShibaMovementConfig* ChangedConfig)
+{
+    if (ChangedConfig && ChangedConfig == MovementConfig)
+    {
+        ApplyMovementConfig();
+    }
+}
+#endif
+
+EShibaSpeedMode UShibaGMCMovement::ResolveSpeedMode(const AShibaCharacter* ShibaChar) const
+{
+    // Swimming overrides every gait so SwimSpeed alone sets the water speed; below that, the same
+    // priority the old GetCurrentMovementSpeed branches used, extended with the special modes
+    const EShibaActionFlags Flags = static_cast<EShibaActionFlags>(ShibaChar->ActionFlags);
+
+    if (IsSwimming()) return EShibaSpeedMode::Swim;
+    if (EnumHasAnyFlags(Flags, EShibaActionFlags::Crouching)) return EShibaSpeedMode::Crouch;
+    if (EnumHasAnyFlags(Flags, EShibaActionFlags::Sprinting)) return EShibaSpeedMode::Sprint;
+    if (ShibaChar->bIsWalking) return EShibaSpeedMode::Walk;
+    if (EnumHasAnyFlags(Flags, EShibaActionFlags::CarryingObject)) return EShibaSpeedMode::Carry;
+    if (EnumHasAnyFlags(Flags, EShibaActionFlags::Sniffing)) return EShibaSpeedMode::Sniff;
+    return EShibaSpeedMode::Run;
+}
+
+float UShibaGMCMovement::GetCurrentModeSpeed() const
+{
+    const AShibaCharacter* ShibaChar = GetShibaCharacter();
+    return ShibaChar ? MovementParams.GetSpeed(ResolveSpeedMode(ShibaChar)) : MovementParams.GetSpeed(EShibaSpeedMode::Run);
+}
+
 void UShibaGMCMovement::SetupPlayerInputComponent_Implementation(UInputComponent* PlayerInputComponent)
 {
     // Call parent implementation first (important for GMC)
@@ -53,62 +142,71 @@ void UShibaGMCMovement::BindReplicationData_Implementation()
 {
     Super::BindReplicationData_Implementation();
 
-    // Network optimized jump replication
-    BindBool(
-        bWantsToJump,
+    // Edge-triggered inputs (jump) - always combine for responsive jumps
+    BindInt(
+        InputEdgeFlags,
         EGMC_PredictionMode::ClientAuth_Input,
-        EGMC_CombineMode::AlwaysCombine,        // Immediate sending for responsive jumps
-        EGMC_SimulationMode::Periodic_Output,   
+        EGMC_CombineMode::AlwaysCombine,
+        EGMC_SimulationMode::Periodic_Output,
         EGMC_InterpolationFunction::NearestNeighbour
     );
 
-    // Other abilities can use periodic updates
-    BindBool(
-        bWantsToSprint,
+    // Held inputs (sprint, crouch, bark, sniff, howl) share one bound bitmask
+    BindInt(
+        InputFlags,
         EGMC_PredictionMode::ClientAuth_Input,
         EGMC_CombineMode::CombineIfUnchanged,
         EGMC_SimulationMode::Periodic_Output,
         EGMC_InterpolationFunction::NearestNeighbour
     );
-    
-    BindBool(
-        bWantsToCrouch,
-        EGMC_PredictionMode::ClientAuth_Input,
+
+    // Stamina is simulated by both sides; the server's value wins only when the client's drifts.
+    // Full precision on purpose - one move's drain (~0.3) is below a byte step over 0-100, so a
+    // quantized value could never match the client's prediction and would correct every move
+    BindSinglePrecisionFloat(
+        Stamina,
+        EGMC_PredictionMode::ServerAuth_Output_ClientValidated,
         EGMC_CombineMode::CombineIfUnchanged,
-        EGMC_SimulationMode::Periodic_Output,
-        EGMC_InterpolationFunction::NearestNeighbour
+        EGMC_SimulationMode::None,
+        EGMC_InterpolationFunction::TargetValue
     );
-    
+
     BindBool(
-        bWantsToBark,
-        EGMC_PredictionMode::ClientAuth_Input,
+        bStaminaExhausted,
+        EGMC_PredictionMode::ServerAuth_Output_ClientValidated,
         EGMC_CombineMode::CombineIfUnchanged,
-        EGMC_SimulationMode::Periodic_Output,
-        EGMC_InterpolationFunction::NearestNeighbour
+        EGMC_SimulationMode::None,
+        EGMC_InterpolationFunction::TargetValue
     );
-    
+
     BindBool(
-        bWantsToSniff,
-        EGMC_PredictionMode::ClientAuth_Input,
+        bSprintNeedsRepress,
+        EGMC_PredictionMode::ServerAuth_Output_ClientValidated,
         EGMC_CombineMode::CombineIfUnchanged,
-        EGMC_SimulationMode::Periodic_Output,
-        EGMC_InterpolationFunction::NearestNeighbour
+        EGMC_SimulationMode::None,
+        EGMC_InterpolationFunction::TargetValue
     );
 
-    BindBool(
-        bWantsToHowl,
-        EGMC_PredictionMode::ClientAuth_Input,
+    // Post-move location, linearly interpolated between received states on simulated proxies - the
+    // target their smoothing should land on, so the smoothing stat doesn't count turns as error
+    BindCompressedVector(
+        MoveEndLocation,
+        EGMC_PredictionMode::ServerAuth_Output_ClientValidated,
         EGMC_CombineMode::CombineIfUnchanged,
         EGMC_SimulationMode::Periodic_Output,
-        EGMC_InterpolationFunction::NearestNeighbour
+        EGMC_InterpolationFunction::Linear
     );
 }
 
 void UShibaGMCMovement::PreMovementUpdate_Implementation(float DeltaTime)
 {
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_ShibaPreMovement, Movement);
+
     // Call parent FIRST - this processes input into ProcessedInputVector
     Super::PreMovementUpdate_Implementation(DeltaTime);
 
+    bInPredictedMove = true;
+
     // Pre-movement setup for Shiba-specific logic
     AShibaCharacter* ShibaChar = GetShibaCharacter();
     if (!ShibaChar)
@@ -116,16 +214,22 @@ void UShibaGMCMovement::PreMovementUpdate_Implementation(float DeltaTime)
         return;
     }
 
+    TrackClientPrediction();
+
     // Process dog-specific input
     ProcessDogInput(DeltaTime);
 
-    // Set speed based on current character setup
-    float CurrentSpeed = ShibaChar->GetCurrentMovementSpeed();
-    MaxDesiredSpeed = CurrentSpeed;
+    // Stamina after input so a sprint stopped this move already regenerates
+    UpdateStamina(DeltaTime);
+
+    // Set speed from the flattened speed table, scaled by the surface under the dog
+    MaxDesiredSpeed = MovementParams.GetSpeed(ResolveSpeedMode(ShibaChar)) * GetSurfaceSpeedMultiplier();
 }
 
 void UShibaGMCMovement::MovementUpdate_Implementation(float DeltaTime)
 {
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_ShibaMovementUpdate, Movement);
+
     Super::MovementUpdate_Implementation(DeltaTime);
 
     AShibaCharacter* ShibaChar = GetShibaCharacter();
@@ -135,98 +239,265 @@ void UShibaGMCMovement::MovementUpdate_Implementation(float DeltaTime)
     }
 
     // Handle jump input
-    if (bWantsToJump)
+    if (HasInputFlag(EShibaInputFlags::Jump))
     {
         ShibaChar->StartJump();
-        bWantsToJump = false;
+        SetInputFlag(EShibaInputFlags::Jump, false);
     }
 
     // Handle bark input
-    if (bWantsToBark)
+    if (HasInputFlag(EShibaInputFlags::Bark))
     {
-        UE_LOG(LogTemp, Warning, TEXT("🎵 GMC: Processing bWantsToBark flag"));
+        NAUGHTY_DEBUG_MSG(Movement, FColor::Yellow, 2.0f, TEXT("GMC: Processing Bark input flag"));
         ShibaChar->StartBark();
-        bWantsToBark = false;  // Reset flag immediately
+        SetInputFlag(EShibaInputFlags::Bark, false);  // Reset flag immediately
     }
 
     // Handle sniff input
-    if (bWantsToSniff)
+    if (HasInputFlag(EShibaInputFlags::Sniff))
     {
-        // DEBUG: Show current state before toggle
-        if (GEngine)
-        {
-            FString PlayerType = ShibaChar->IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-            FString CurrentStateStr = ShibaChar->IsInState(EShibaCharacterState::Sniffing) ? TEXT("SNIFFING") : TEXT("NOT_SNIFFING");
-        
-            GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Yellow, 
-                FString::Printf(TEXT("🟡 [%s] GMC: Processing Sniff (Current: %s)"), *PlayerType, *CurrentStateStr));
-        }
+        NAUGHTY_DEBUG_MSG(Movement, FColor::Yellow, 2.0f, TEXT("[%s] GMC: Processing Sniff (Current: %s)"),
+            ShibaChar->IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"),
+            ShibaChar->IsInState(EShibaCharacterState::Sniffing) ? TEXT("SNIFFING") : TEXT("NOT_SNIFFING"));
 
         // Simple toggle - each press switches state
         if (ShibaChar->IsInState(EShibaCharacterState::Sniffing))
         {
-            if (GEngine)
-            {
-                FString PlayerType = ShibaChar->IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-                GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Magenta, 
-                    FString::Printf(TEXT("🟣 [%s] GMC: Calling STOP Sniff"), *PlayerType));
-            }
+            NAUGHTY_DEBUG_MSG(Movement, FColor::Magenta, 2.0f, TEXT("[%s] GMC: Calling STOP Sniff"),
+                ShibaChar->IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
             ShibaChar->StopSniffVision();
         }
         else
         {
-            if (GEngine)
-            {
-                FString PlayerType = ShibaChar->IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-                GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Green, 
-                    FString::Printf(TEXT("🟢 [%s] GMC: Calling START Sniff"), *PlayerType));
-            }
+            NAUGHTY_DEBUG_MSG(Movement, FColor::Green, 2.0f, TEXT("[%s] GMC: Calling START Sniff"),
+                ShibaChar->IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE"));
             ShibaChar->StartSniffVision();
         }
     
         // CRITICAL: Reset flag immediately after processing
-        bWantsToSniff = false;
-    
-        // DEBUG: Confirm flag reset
-        if (GEngine)
-        {
-            FString PlayerType = ShibaChar->IsLocallyControlled() ? TEXT("LOCAL") : TEXT("REMOTE");
-            GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::Red, 
-                FString::Printf(TEXT("🔴 [%s] GMC: Flag RESET"), *PlayerType));
-        }
+        SetInputFlag(EShibaInputFlags::Sniff, false);
     }
 
-    if (bWantsToHowl)
+    if (HasInputFlag(EShibaInputFlags::Howl))
     {
-        UE_LOG(LogTemp, Warning, TEXT("🎵 GMC: Processing bWantsToHowl flag"));
+        NAUGHTY_DEBUG_MSG(Movement, FColor::Yellow, 2.0f, TEXT("GMC: Processing Howl input flag"));
         ShibaChar->StartHowl();
-        bWantsToHowl = false;  // Reset flag immediately
+        SetInputFlag(EShibaInputFlags::Howl, false);  // Reset flag immediately
     }
 }
 
 void UShibaGMCMovement::PostMovementUpdate_Implementation(float DeltaTime)
 {
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_ShibaPostMovement, Movement);
+
     Super::PostMovementUpdate_Implementation(DeltaTime);
 
     // Post-movement cleanup and state management
     AShibaCharacter* ShibaChar = GetShibaCharacter();
     if (!ShibaChar)
     {
+        bInPredictedMove = false;
         return;
     }
 
+    // Use the move's own timestamp so replayed moves are stamped with the time they were made
+    const float MoveTime = GetMoveTimestamp();
+
     // Track movement state changes
     bool bIsMovingNow = GetVelocity().Size() > 1.0f;
     if (bIsMovingNow != bWasMovingLastFrame)
     {
-        LastSpeedChangeTime = GetWorld()->GetTimeSeconds();
+        LastSpeedChangeTime = MoveTime;
         bWasMovingLastFrame = bIsMovingNow;
     }
+
+    // Character logic runs once per simulated move (including client replays) so state stays in phase with prediction;
+    // the character suppresses its cosmetic events while CL_IsReplaying() so corrections don't replay jump/land effects
+    if (ShibaChar->bDriveLogicFromMovement)
+    {
+        ShibaChar->UpdateCharacterLogic(MoveTime);
+    }
+
+    MoveEndLocation = ShibaChar->GetActorLocation();
+
+    if (GetOwnerRole() == ROLE_AutonomousProxy && !CL_IsReplaying())
+    {
+        LastPredictedLocation = ShibaChar->GetActorLocation();
+        NetStats.Update(GetWorld()->GetRealTimeSeconds());
+    }
+
+    bInPredictedMove = false;
+}
+
+void UShibaGMCMovement::MovementUpdateSimulated_Implementation(float DeltaTime)
+{
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_ShibaMovementSimulated, Movement);
+
+    Super::MovementUpdateSimulated_Implementation(DeltaTime);
+
+    // Simulated proxies don't run the predicted move callbacks, so drive their character logic here,
+    // at the rate their significance tier allows (the actor tick that tier used to throttle is off in this mode)
+    AShibaCharacter* ShibaChar = GetShibaCharacter();
+    if (ShibaChar && ShibaChar->bDriveLogicFromMovement)
+    {
+        const float TimeSeconds = GetWorld()->GetTimeSeconds();
+        const float Interval = UShibaSignificanceManager::GetTierSettings(ShibaChar->GetSignificanceTier()).ActorTickInterval;
+
+        if (UShibaSignificanceManager::ShouldRunTierUpdate(Interval, TimeSeconds, ShibaChar->NextSimulatedLogicTime))
+        {
+            ShibaChar->UpdateCharacterLogic(TimeSeconds);
+        }
+    }
+
+    TrackSimulatedSmoothing(DeltaTime);
 }
 
 void UShibaGMCMovement::SetWantsToJump(bool bWants) 
 { 
-    bWantsToJump = bWants; 
+    SetInputFlag(EShibaInputFlags::Jump, bWants); 
+}
+
+float UShibaGMCMovement::GetSurfaceSpeedMultiplier() const
+{
+    // Swimming speed comes from the Swim row of the speed table, and airborne moves are not slowed by
+    // the last surface, so the result only depends on this move's floor
+    if (IsSwimming() || !IsMovingOnGround())
+    {
+        return 1.0f;
+    }
+
+    // Reuse the floor GMC already found for this move - no extra traces
+    const FHitResult& FloorHit = CurrentFloor.HitResult;
+    return LookupSurfaceSpeedMultiplier(FloorHit.GetComponent(), FloorHit.PhysMaterial.Get());
+}
+
+float UShibaGMCMovement::LookupSurfaceSpeedMultiplier(const UPrimitiveComponent* FloorComponent, const UPhysicalMaterial* FloorMaterial) const
+{
+    if (!FloorComponent)
+    {
+        return 1.0f;
+    }
+
+    if (CachedFloorComponent.Get() == FloorComponent && CachedFloorMaterial.Get() == FloorMaterial)
+    {
+        return CachedSurfaceMultiplier;
+    }
+
+    // Floor queries don't always return a material; fall back to the body's simple material
+    const UPhysicalMaterial* Material = FloorMaterial;
+    if (!Material)
+    {
+        if (const FBodyInstance* Body = FloorComponent->GetBodyInstance())
+        {
+            Material = Body->GetSimplePhysicalMaterial();
+        }
+    }
+
+    const EPhysicalSurface SurfaceType = Material ? UPhysicalMaterial::DetermineSurfaceType(Material) : SurfaceType_Default;
+
+    CachedFloorComponent = FloorComponent;
+    CachedFloorMaterial = FloorMaterial;
+    CachedSurfaceMultiplier = MovementParams.SurfaceSpeedTable[SurfaceType];
+    return CachedSurfaceMultiplier;
+}
+
+void UShibaGMCMovement::UpdateStamina(float DeltaTime)
+{
+    const float MaxStamina = MovementParams.MaxStamina;
+    const float Drain = MovementParams.SprintStaminaDrain;
+    const float Regen = MovementParams.StaminaRegenRate;
+    const float RecoverThreshold = MovementParams.LowStaminaThreshold;
+
+    // Only bound move state feeds the drain (input bits, exhaustion, GMC velocity/floor), so a replay reproduces
+    // it exactly; the actor's sprint flag is set outside the move and may not match the move being replayed
+    const bool bDraining = IsSprintMove() && IsMovingOnGround() && GetVelocity().SizeSquared() > 1.0f;
+    if (bDraining)
+    {
+        Stamina = FMath::Max(Stamina - Drain * DeltaTime, 0.0f);
+        if (Stamina <= 0.0f)
+        {
+            // Running dry also latches the sprint off until the input is released
+            bStaminaExhausted = true;
+            bSprintNeedsRepress = true;
+        }
+    }
+    else
+    {
+        Stamina = FMath::Min(Stamina + Regen * DeltaTime, MaxStamina);
+        if (bStaminaExhausted && Stamina >= RecoverThreshold)
+        {
+            bStaminaExhausted = false;
+        }
+    }
+}
+
+bool UShibaGMCMovement::IsSprintMove() const
+{
+    // ResolveSpeedMode's priority (Swim, then Crouch, then Sprint) evaluated on the bound inputs only
+    return HasInputFlag(EShibaInputFlags::Sprint)
+        && !HasInputFlag(EShibaInputFlags::Crouch)
+        && !IsSwimming()
+        && !bStaminaExhausted
+        && !bSprintNeedsRepress;
+}
+
+void UShibaGMCMovement::TrackClientPrediction()
+{
+    if (GetOwnerRole() != ROLE_AutonomousProxy)
+    {
+        return;
+    }
+
+    // A correction triggers one replay of every unacknowledged move; count the replay once, not per move
+    const bool bReplaying = CL_IsReplaying();
+    if (bReplaying)
+    {
+        NetStats.AddReplayedMove();
+    }
+    else
+    {
+        // First fresh move after a replay starts where the corrected prediction ended up
+        if (bWasReplaying)
+        {
+            NetStats.AddCorrection(FVector::Dist(GetOwner()->GetActorLocation(), LastPredictedLocation));
+        }
+        NetStats.AddPredictedMove();
+    }
+    bWasReplaying = bReplaying;
+}
+
+void UShibaGMCMovement::TrackSimulatedSmoothing(float DeltaTime)
+{
+    // No target until the first server state has arrived
+    if (GetOwnerRole() != ROLE_SimulatedProxy || DeltaTime <= 0.0f || MoveEndLocation.IsZero())
+    {
+        return;
+    }
+
+    // Rendered location against the interpolation target for the same instant; turns and
+    // acceleration move both together, so only extrapolation, snapping and lag show up
+    NetStats.AddSmoothingSample(FVector::Dist(GetOwner()->GetActorLocation(), MoveEndLocation));
+
+    NetStats.Update(GetWorld()->GetRealTimeSeconds());
+}
+
+FShibaNetStats UShibaGMCMovement::GetNetStats() const
+{
+    FShibaNetStats Stats = NetStats.GetStats();
+
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    if (const APlayerState* PlayerState = Pawn ? Pawn->GetPlayerState() : nullptr)
+    {
+        Stats.PingMs = PlayerState->GetPingInMilliseconds();
+    }
+
+    if (const UNetConnection* Connection = GetOwner()->GetNetConnection())
+    {
+        Stats.InPacketLossPercent = Connection->GetInLossPercentage().GetAvgLossPercentage() * 100.0f;
+        Stats.OutPacketLossPercent = Connection->GetOutLossPercentage().GetAvgLossPercentage() * 100.0f;
+    }
+
+    return Stats;
 }
 
 AShibaCharacter* UShibaGMCMovement::GetShibaCharacter() const
@@ -242,8 +513,22 @@ void UShibaGMCMovement::ProcessDogInput(float DeltaTime)
         return;
     }
 
-    // Handle sprint input
-    if (bWantsToSprint && !ShibaChar->IsInState(EShibaCharacterState::Sprinting))
+    const bool bWantsToSprint = HasInputFlag(EShibaInputFlags::Sprint);
+    const bool bWantsToCrouch = HasInputFlag(EShibaInputFlags::Crouch);
+
+    // Releasing sprint re-arms it after running dry
+    if (!bWantsToSprint)
+    {
+        bSprintNeedsRepress = false;
+    }
+
+    // Handle sprint input (blocked while exhausted)
+    if (bStaminaExhausted && ShibaChar->bIsSprinting)
+    {
+        // Ran dry - drop the sprint; holding the input doesn't resume it, the player has to press again
+        ShibaChar->StopSprint();
+    }
+    else if (bWantsToSprint && !bStaminaExhausted && !bSprintNeedsRepress && !ShibaChar->IsInState(EShibaCharacterState::Sprinting))
     {
         if (GetVelocity().Size() > 1.0f)
         {
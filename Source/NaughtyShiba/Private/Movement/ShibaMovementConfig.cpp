@@ -1,7 +1,58 @@
 #include "Movement/ShibaMovementConfig.h"
 
+#if WITH_EDITOR
+UShibaMovementConfig::FOnMovementConfigChanged UShibaMovementConfig::OnMovementConfigChanged;
+#endif
+
 UShibaMovementConfig::UShibaMovementConfig()
 {
 	// Default values are set in header file
 	// This constructor can be used for any special initialization
-}
\ No newline at end of file
+}
+
+float UShibaMovementConfig::GetSurfaceSpeedMultiplier(EPhysicalSurface SurfaceType) const
+{
+	if (SurfaceType == SurfaceType_Default)
+	{
+		return 1.0f;
+	}
+
+	if (SurfaceType == GrassSurface) return GrassSpeedMultiplier;
+	if (SurfaceType == MudSurface) return MudSpeedMultiplier;
+	if (SurfaceType == IceSurface) return IceSpeedMultiplier;
+	if (SurfaceType == WaterSurface) return WaterSpeedMultiplier;
+
+	return 1.0f;
+}
+
+void UShibaMovementConfig::FlattenInto(FShibaMovementParams& OutParams) const
+{
+	OutParams.SpeedTable[(int32)EShibaSpeedMode::Crouch] = CrouchSpeed;
+	OutParams.SpeedTable[(int32)EShibaSpeedMode::Sprint] = SprintSpeed;
+	OutParams.SpeedTable[(int32)EShibaSpeedMode::Walk] = WalkSpeed;
+	OutParams.SpeedTable[(int32)EShibaSpeedMode::Swim] = SwimSpeed;
+	OutParams.SpeedTable[(int32)EShibaSpeedMode::Carry] = CarrySpeed;
+	OutParams.SpeedTable[(int32)EShibaSpeedMode::Sniff] = SniffSpeed;
+	OutParams.SpeedTable[(int32)EShibaSpeedMode::Run] = RunSpeed;
+
+	for (int32 SurfaceIndex = 0; SurfaceIndex < SurfaceType_Max; ++SurfaceIndex)
+	{
+		OutParams.SurfaceSpeedTable[SurfaceIndex] = GetSurfaceSpeedMultiplier(static_cast<EPhysicalSurface>(SurfaceIndex));
+	}
+
+	OutParams.JumpVelocity = JumpVelocity;
+
+	OutParams.MaxStamina = MaxStamina;
+	OutParams.SprintStaminaDrain = SprintStaminaDrain;
+	OutParams.StaminaRegenRate = StaminaRegenRate;
+	OutParams.LowStaminaThreshold = LowStaminaThreshold;
+}
+
+#if WITH_EDITOR
+void UShibaMovementConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	OnMovementConfigChanged.Broadcast(this);
+}
+#endif
@@ -0,0 +1,58 @@
+#include "Movement/ShibaNetStats.h"
+
+void FShibaNetStatsCollector::AddPredictedMove()
+{
+    ++Stats.TotalPredictedMoves;
+}
+
+void FShibaNetStatsCollector::AddReplayedMove()
+{
+    ++Stats.TotalReplayedMoves;
+    ++WindowReplayedMoves;
+}
+
+void FShibaNetStatsCollector::AddCorrection(float Distance)
+{
+    ++Stats.TotalCorrections;
+    ++WindowCorrections;
+    WindowCorrectionSum += Distance;
+    WindowCorrectionMax = FMath::Max(WindowCorrectionMax, Distance);
+}
+
+void FShibaNetStatsCollector::AddSmoothingSample(float Error)
+{
+    ++WindowSmoothingSamples;
+    WindowSmoothingSum += Error;
+    WindowSmoothingMax = FMath::Max(WindowSmoothingMax, Error);
+}
+
+void FShibaNetStatsCollector::Update(double TimeSeconds)
+{
+    if (WindowStart < 0.0)
+    {
+        WindowStart = TimeSeconds;
+        return;
+    }
+
+    const double WindowLength = TimeSeconds - WindowStart;
+    if (WindowLength < 1.0)
+    {
+        return;
+    }
+
+    Stats.CorrectionsPerSecond = WindowCorrections / WindowLength;
+    Stats.AverageCorrectionDistance = WindowCorrections > 0 ? WindowCorrectionSum / WindowCorrections : 0.0f;
+    Stats.MaxCorrectionDistance = WindowCorrectionMax;
+    Stats.ReplayedMovesPerCorrection = WindowCorrections > 0 ? static_cast<float>(WindowReplayedMoves) / WindowCorrections : 0.0f;
+    Stats.AverageSmoothingError = WindowSmoothingSamples > 0 ? WindowSmoothingSum / WindowSmoothingSamples : 0.0f;
+    Stats.MaxSmoothingError = WindowSmoothingMax;
+
+    WindowStart = TimeSeconds;
+    WindowCorrections = 0;
+    WindowReplayedMoves = 0;
+    WindowCorrectionSum = 0.0f;
+    WindowCorrectionMax = 0.0f;
+    WindowSmoothingSamples = 0;
+    WindowSmoothingSum = 0.0f;
+    WindowSmoothingMax = 0.0f;
+}
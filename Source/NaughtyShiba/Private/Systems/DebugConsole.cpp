@@ -1,7 +1,7 @@
 #include "Systems/DebugConsole.h"
+#include "NaughtyShiba.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
-#include "DrawDebugHelpers.h"
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerState.h"
 #include "Kismet/GameplayStatics.h"
@@ -13,6 +13,14 @@
 #include "Components/InputManagerComponent.h"
 #include "Components/BaseGameComponent.h"
 #include "Characters/ShibaCharacter.h"  
+#include "Movement/ShibaGMCMovement.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "Systems/NaughtyProfiler.h"
+#include "Systems/NaughtyPerfMonitor.h"
+#include "Systems/NaughtyDebugChannels.h"
+#include "Systems/NaughtyDebugDraw.h"
+#include "Misc/Paths.h"
 
 // Define log categories
 DECLARE_LOG_CATEGORY_EXTERN(LogNaughtyDebug, Log, All);
@@ -104,7 +112,19 @@ void UDebugConsole::InitializeCommands()
 
     RegisterCommand(TEXT("perfmon"), 
         [this](const TArray<FString>& Args) { HandlePerfMonCommand(Args); },
-        TEXT("perfmon [on|off] - Toggle performance monitoring display"));
+        TEXT("perfmon [on|off|csv [file]] - Toggle the live performance overlay or dump its samples to CSV"));
+
+    RegisterCommand(TEXT("profile"), 
+        [this](const TArray<FString>& Args) { HandleProfileCommand(Args); },
+        TEXT("profile [reset] - Show profiling zone timings (min/avg/p95/p99/max)"));
+
+    RegisterCommand(TEXT("channel"), 
+        [this](const TArray<FString>& Args) { HandleChannelCommand(Args); },
+        TEXT("channel [<name>|all] [on|off] - List or toggle debug message channels (Movement, Abilities, Anim, Input)"));
+
+    RegisterCommand(TEXT("debugdraw"), 
+        [this](const TArray<FString>& Args) { HandleDebugDrawCommand(Args); },
+        TEXT("debugdraw [budget <lines>] - Show debug draw batch usage or set the per-frame line budget"));
 
     RegisterCommand(TEXT("timesync"), 
         [this](const TArray<FString>& Args) { HandleTimeSyncCommand(Args); },
@@ -112,7 +132,7 @@ void UDebugConsole::InitializeCommands()
 
     RegisterCommand(TEXT("lagtest"), 
     [this](const TArray<FString>& Args) { HandleLagTestCommand(Args); },
-    TEXT("lagtest <ms> - Simulate network lag for testing"));
+    TEXT("lagtest <lag_ms> [jitter_ms] [loss_pct] [reorder 0|1] [conn] | off | status - Emulate a bad network on the live net driver"));
 
     RegisterCommand(TEXT("disconnect"), 
         [this](const TArray<FString>& Args) { HandleDisconnectCommand(Args); },
@@ -373,6 +393,18 @@ void UDebugConsole::HandleNetInfoCommand(const TArray<FString>& Args)
     LogInfo(FString::Printf(TEXT("Network Mode: %s"), *NetModeStr));
     LogInfo(FString::Printf(TEXT("Has Authority: %s"), World->GetAuthGameMode() ? TEXT("Yes") : TEXT("No")));
     LogInfo(FString::Printf(TEXT("GMCv2 Integration: Active")));
+
+    // Prediction quality for the local dog (same numbers WBP_NetworkDebug shows)
+    APlayerController* PC = World->GetFirstPlayerController();
+    AShibaCharacter* ShibaChar = PC ? Cast<AShibaCharacter>(PC->GetPawn()) : nullptr;
+    if (UShibaGMCMovement* Movement = ShibaChar ? ShibaChar->GetGMCMovementComponent() : nullptr)
+    {
+        const FShibaNetStats Stats = Movement->GetNetStats();
+        LogInfo(FString::Printf(TEXT("Ping: %.0f ms, loss in %.1f%% out %.1f%%"), Stats.PingMs, Stats.InPacketLossPercent, Stats.OutPacketLossPercent));
+        LogInfo(FString::Printf(TEXT("Corrections: %.2f/s (avg %.1f cm, max %.1f cm), %.1f replayed moves each, %d total"),
+            Stats.CorrectionsPerSecond, Stats.AverageCorrectionDistance, Stats.MaxCorrectionDistance,
+            Stats.ReplayedMovesPerCorrection, Stats.TotalCorrections));
+    }
 }
 
 void UDebugConsole::HandlePlayersCommand(const TArray<FString>& Args)
@@ -410,29 +442,114 @@ void UDebugConsole::HandlePlayersCommand(const TArray<FString>& Args)
 
 void UDebugConsole::HandlePerfMonCommand(const TArray<FString>& Args)
 {
+    UNaughtyPerfMonitor* PerfMonitor = UNaughtyPerfMonitor::Get(CachedWorld);
+    if (!PerfMonitor)
+    {
+        LogError(TEXT("Performance monitor not available in this world"));
+        return;
+    }
+
     if (Args.Num() > 0)
     {
         FString Command = Args[0].ToLower();
         if (Command == TEXT("on"))
         {
-            bDebugDisplayEnabled = true;
+            PerfMonitor->SetOverlayVisible(true);
             LogInfo(TEXT("Performance monitoring enabled"));
         }
         else if (Command == TEXT("off"))
         {
-            bDebugDisplayEnabled = false;
+            PerfMonitor->SetOverlayVisible(false);
             LogInfo(TEXT("Performance monitoring disabled"));
         }
+        else if (Command == TEXT("csv"))
+        {
+            const FString FilePath = Args.Num() > 1 ? Args[1] :
+                FPaths::ProjectSavedDir() / TEXT("PerfMon") / FString::Printf(TEXT("PerfMon_%s.csv"), *FDateTime::Now().ToString());
+
+            if (PerfMonitor->DumpCsv(FilePath))
+            {
+                LogInfo(FString::Printf(TEXT("Wrote %d samples to %s"), PerfMonitor->GetNumSamples(), *FilePath));
+            }
+            else
+            {
+                LogError(FString::Printf(TEXT("Failed to write %s"), *FilePath));
+            }
+        }
         else
         {
-            LogError(TEXT("Usage: perfmon [on|off]"));
+            LogError(TEXT("Usage: perfmon [on|off|csv [file]]"));
         }
     }
     else
     {
         LogInfo(FString::Printf(TEXT("Performance monitoring: %s"), 
-                              bDebugDisplayEnabled ? TEXT("On") : TEXT("Off")));
+                              PerfMonitor->IsOverlayVisible() ? TEXT("On") : TEXT("Off")));
+    }
+}
+
+void UDebugConsole::HandleChannelCommand(const TArray<FString>& Args)
+{
+#if NAUGHTY_DEBUG
+    if (Args.Num() == 0)
+    {
+        for (int32 Index = 0; Index < (int32)ENaughtyDebugChannel::Num; ++Index)
+        {
+            const ENaughtyDebugChannel Channel = (ENaughtyDebugChannel)Index;
+            LogInfo(FString::Printf(TEXT("%s: %s"), FNaughtyDebugChannels::GetName(Channel),
+                FNaughtyDebugChannels::IsEnabled(Channel) ? TEXT("On") : TEXT("Off")));
+        }
+        return;
+    }
+
+    // No state argument flips the channel
+    const FString State = Args.Num() > 1 ? Args[1].ToLower() : FString();
+    if (!State.IsEmpty() && State != TEXT("on") && State != TEXT("off"))
+    {
+        LogError(TEXT("Usage: channel [<name>|all] [on|off]"));
+        return;
+    }
+
+    if (Args[0].ToLower() == TEXT("all"))
+    {
+        FNaughtyDebugChannels::SetAllEnabled(State != TEXT("off"));
+        LogInfo(FString::Printf(TEXT("All debug channels: %s"), State != TEXT("off") ? TEXT("On") : TEXT("Off")));
+        return;
+    }
+
+    ENaughtyDebugChannel Channel;
+    if (!FNaughtyDebugChannels::FindChannel(Args[0], Channel))
+    {
+        LogError(FString::Printf(TEXT("Unknown channel '%s'"), *Args[0]));
+        return;
+    }
+
+    const bool bEnable = State.IsEmpty() ? !FNaughtyDebugChannels::IsEnabled(Channel) : State == TEXT("on");
+    FNaughtyDebugChannels::SetEnabled(Channel, bEnable);
+    LogInfo(FString::Printf(TEXT("%s: %s"), FNaughtyDebugChannels::GetName(Channel), bEnable ? TEXT("On") : TEXT("Off")));
+#else
+    LogWarning(TEXT("Debug channels are compiled out of this build"));
+#endif
+}
+
+void UDebugConsole::HandleDebugDrawCommand(const TArray<FString>& Args)
+{
+    UNaughtyDebugDrawSubsystem* DebugDraw = UNaughtyDebugDrawSubsystem::Get(CachedWorld);
+    if (!DebugDraw)
+    {
+        LogError(TEXT("Debug draw batcher not available in this world"));
+        return;
+    }
+
+    if (Args.Num() >= 2 && Args[0].ToLower() == TEXT("budget"))
+    {
+        DebugDraw->SetLineBudget(FCString::Atoi(*Args[1]));
+        LogInfo(FString::Printf(TEXT("Debug draw line budget: %d"), DebugDraw->GetLineBudget()));
+        return;
     }
+
+    LogInfo(FString::Printf(TEXT("Debug draw: %d/%d lines last frame, %d shapes dropped, %d text lines"),
+        DebugDraw->GetLastLineCount(), DebugDraw->GetLineBudget(), DebugDraw->GetLastDroppedShapes(), DebugDraw->GetNumTextEntries()));
 }
 
 void UDebugConsole::HandleTimeSyncCommand(const TArray<FString>& Args)
@@ -510,17 +627,85 @@ void UDebugConsole::HandleTimeSyncCommand(const TArray<FString>& Args)
 
 void UDebugConsole::HandleLagTestCommand(const TArray<FString>& Args)
 {
+#if DO_ENABLE_NET_TEST
+    UWorld* World = GetCurrentGameWorld();
+    UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+    if (!NetDriver)
+    {
+        LogError(TEXT("lagtest needs a networked game (no net driver)"));
+        return;
+    }
+
     if (Args.Num() < 1)
     {
-        LogError(TEXT("Usage: lagtest <milliseconds>"));
+        LogError(TEXT("Usage: lagtest <lag_ms> [jitter_ms] [loss_pct] [reorder 0|1] [conn] | off | status"));
         return;
     }
-    
-    float LagMS = FCString::Atof(*Args[0]);
-    
-    // Note: This is a simplified example - real lag simulation requires more complex implementation
-    LogInfo(FString::Printf(TEXT("Lag test: %.1f ms simulation requested"), LagMS));
-    LogInfo(TEXT("Note: Full lag simulation will be implemented with character movement"));
+
+    // Client: the one server connection; server: every client connection
+    TArray<UNetConnection*> Connections;
+    if (NetDriver->ServerConnection)
+    {
+        Connections.Add(NetDriver->ServerConnection);
+    }
+    Connections.Append(NetDriver->ClientConnections);
+
+    const FString Mode = Args[0].ToLower();
+    if (Mode == TEXT("status"))
+    {
+        for (int32 i = 0; i < Connections.Num(); i++)
+        {
+            const FPacketSimulationSettings& Current = Connections[i]->PacketSimulationSettings;
+            LogInfo(FString::Printf(TEXT("[%d] %s: lag %d-%d ms, loss %d%%, reorder %s, ping %.0f ms"),
+                i, *Connections[i]->LowLevelGetRemoteAddress(), Current.PktLagMin, Current.PktLagMax,
+                Current.PktLoss, Current.PktOrder ? TEXT("on") : TEXT("off"), Connections[i]->AvgLag * 1000.0f));
+        }
+        return;
+    }
+
+    // Outgoing only - run lagtest on both ends for symmetric conditions
+    FPacketSimulationSettings Settings;
+    if (Mode != TEXT("off"))
+    {
+        const int32 LagMs = FMath::Max(FCString::Atoi(*Args[0]), 0);
+        const int32 JitterMs = Args.IsValidIndex(1) ? FMath::Max(FCString::Atoi(*Args[1]), 0) : 0;
+
+        Settings.PktLagMin = FMath::Max(LagMs - JitterMs, 0);
+        Settings.PktLagMax = LagMs + JitterMs;
+        Settings.PktLoss = Args.IsValidIndex(2) ? FMath::Clamp(FCString::Atoi(*Args[2]), 0, 100) : 0;
+        Settings.PktOrder = Args.IsValidIndex(3) ? (FCString::Atoi(*Args[3]) != 0 ? 1 : 0) : 0;
+    }
+
+    if (Args.IsValidIndex(4))
+    {
+        // Single connection (server side: emulate one bad client)
+        const int32 Index = FCString::Atoi(*Args[4]);
+        if (!Connections.IsValidIndex(Index))
+        {
+            LogError(FString::Printf(TEXT("No connection %d (see lagtest status)"), Index));
+            return;
+        }
+
+        Connections[Index]->PacketSimulationSettings = Settings;
+    }
+    else
+    {
+        NetDriver->SetPacketSimulationSettings(Settings);
+    }
+
+    if (Mode == TEXT("off"))
+    {
+        LogInfo(TEXT("Lag test: network emulation off"));
+    }
+    else
+    {
+        LogInfo(FString::Printf(TEXT("Lag test: %d-%d ms, %d%% loss, reorder %s on %s"),
+            Settings.PktLagMin, Settings.PktLagMax, Settings.PktLoss, Settings.PktOrder ? TEXT("on") : TEXT("off"),
+            Args.IsValidIndex(4) ? *FString::Printf(TEXT("connection %s"), *Args[4]) : TEXT("all connections")));
+    }
+#else
+    LogError(TEXT("lagtest: packet simulation is compiled out of this build"));
+#endif
 }
 
 void UDebugConsole::HandleDisconnectCommand(const TArray<FString>& Args)
@@ -915,52 +1100,83 @@ void UDebugConsole::HandleSystemsCommand(const TArray<FString>& Args)
     }
 }
 
-void UDebugConsole::LogInfo(const FString& Message)
+void UDebugConsole::AddScreenMessage(const FString& Message, const FColor& Color)
 {
-    NAUGHTY_LOG(Log, TEXT("%s"), *Message);
-    if (GEngine)
+#if NAUGHTY_WITH_SCREEN_DEBUG
+    // Batched per world so repeated messages merge instead of stacking up
+    if (UNaughtyDebugDrawSubsystem* DebugDraw = UNaughtyDebugDrawSubsystem::Get(CachedWorld ? CachedWorld : GetCurrentGameWorld()))
     {
-        GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Green, Message);
+        DebugDraw->AddText(Message, Color, 5.0f);
     }
+    else if (GEngine)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, 5.0f, Color, Message);
+    }
+#endif
+}
+
+void UDebugConsole::LogInfo(const FString& Message)
+{
+    NAUGHTY_LOG(Log, TEXT("%s"), *Message);
+    AddScreenMessage(Message, FColor::Green);
 }
 
 void UDebugConsole::LogWarning(const FString& Message)
 {
     NAUGHTY_LOG(Warning, TEXT("%s"), *Message);
-    if (GEngine)
-    {
-        GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Yellow, Message);
-    }
+    AddScreenMessage(Message, FColor::Yellow);
 }
 
 void UDebugConsole::LogError(const FString& Message)
 {
     NAUGHTY_LOG(Error, TEXT("%s"), *Message);
-    if (GEngine)
-    {
-        GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Red, Message);
-    }
+    AddScreenMessage(Message, FColor::Red);
 }
 
 void UDebugConsole::StartPerformanceTimer(const FString& TimerName)
 {
-    PerformanceTimers.Add(TimerName, FPlatformTime::Seconds());
+    PerformanceTimerStack.Emplace(FName(*TimerName), FPlatformTime::Cycles64());
     NAUGHTY_LOG(VeryVerbose, TEXT("Started timer: %s"), *TimerName);
 }
 
 void UDebugConsole::EndPerformanceTimer(const FString& TimerName)
 {
-    if (PerformanceTimers.Contains(TimerName))
+    // Innermost open timer with this name, so nested timers close in any order
+    const FName Name(*TimerName);
+    const int32 Index = PerformanceTimerStack.FindLastByPredicate([Name](const TPair<FName, uint64>& Timer) { return Timer.Key == Name; });
+    if (Index == INDEX_NONE)
     {
-        double StartTime = PerformanceTimers[TimerName];
-        double ElapsedTime = (FPlatformTime::Seconds() - StartTime) * 1000.0; // Convert to milliseconds
-        
-        LogInfo(FString::Printf(TEXT("Timer '%s': %.2f ms"), *TimerName, ElapsedTime));
-        PerformanceTimers.Remove(TimerName);
+        LogWarning(FString::Printf(TEXT("Timer '%s' not found"), *TimerName));
+        return;
     }
-    else
+
+    const uint64 Cycles = FPlatformTime::Cycles64() - PerformanceTimerStack[Index].Value;
+    PerformanceTimerStack.RemoveAt(Index);
+
+    // Blueprint timers can span frames and close out of order, so they never enter the per-thread category nesting
+    FNaughtyProfiler::RecordSpan(FNaughtyProfiler::RegisterZone(Name), Cycles);
+    LogInfo(FString::Printf(TEXT("Timer '%s': %.2f ms"), *TimerName, FPlatformTime::ToMilliseconds64(Cycles)));
+}
+
+void UDebugConsole::HandleProfileCommand(const TArray<FString>& Args)
+{
+    if (Args.Num() > 0 && Args[0].ToLower() == TEXT("reset"))
     {
-        LogWarning(FString::Printf(TEXT("Timer '%s' not found"), *TimerName));
+        FNaughtyProfiler::Reset();
+        LogInfo(TEXT("Profile zones reset"));
+        return;
+    }
+
+    TArray<FNaughtyProfileZoneStats> Zones;
+    FNaughtyProfiler::GetZoneStats(Zones);
+    Zones.RemoveAll([](const FNaughtyProfileZoneStats& Zone) { return Zone.Count == 0; });
+    Zones.Sort([](const FNaughtyProfileZoneStats& A, const FNaughtyProfileZoneStats& B) { return A.AvgMs * A.Count > B.AvgMs * B.Count; });
+
+    LogInfo(TEXT("=== Profile Zones (last second, by total time) ==="));
+    for (const FNaughtyProfileZoneStats& Zone : Zones)
+    {
+        LogInfo(FString::Printf(TEXT("%-32s %6d calls  min %.3f  avg %.3f  p95 %.3f  p99 %.3f  max %.3f ms"),
+            *Zone.Name.ToString(), Zone.Count, Zone.MinMs, Zone.AvgMs, Zone.P95Ms, Zone.P99Ms, Zone.MaxMs));
     }
 }
 
@@ -977,10 +1193,10 @@ void UDebugConsole::DrawDebugSphere(const FVector& Location, float Radius, const
         return;
     }
     
-    UWorld* World = GetCurrentGameWorld();
-    if (World)
+    if (UNaughtyDebugDrawSubsystem* DebugDraw = UNaughtyDebugDrawSubsystem::Get(GetCurrentGameWorld()))
     {
-        ::DrawDebugSphere(World, Location, Radius, 12, Color, false, 0.1f);
+        // Same 0.1s lifetime as the old ::DrawDebugSphere call, so callers that don't draw every frame keep working
+        DebugDraw->AddSphere(Location, Radius, Color, 0.1f);
     }
 }
 
@@ -991,10 +1207,9 @@ void UDebugConsole::DrawDebugCircle(const FVector& Location, float Radius, const
         return;
     }
     
-    UWorld* World = GetCurrentGameWorld();
-    if (World)
+    if (UNaughtyDebugDrawSubsystem* DebugDraw = UNaughtyDebugDrawSubsystem::Get(GetCurrentGameWorld()))
     {
-        ::DrawDebugCircle(World, Location, Radius, 32, Color, false, 0.1f, 0, 2.0f, FVector(1,0,0), FVector(0,1,0));
+        DebugDraw->AddCircle(Location, Radius, Color, 0.1f, 2.0f);
     }
 }
 
@@ -0,0 +1,87 @@
+#include "Systems/NaughtyDebugChannels.h"
+#include "NaughtyShiba.h"
+#include "Engine/Engine.h"
+#include "Misc/CommandLine.h"
+
+std::atomic<uint32> FNaughtyDebugChannels::EnabledMask{0};
+
+namespace NaughtyDebugChannels
+{
+    // Indexed by ENaughtyDebugChannel
+    static const TCHAR* const ChannelNames[] = { TEXT("Movement"), TEXT("Abilities"), TEXT("Anim"), TEXT("Input") };
+    static_assert(UE_ARRAY_COUNT(ChannelNames) == (int32)ENaughtyDebugChannel::Num, "Channel name missing");
+}
+
+void FNaughtyDebugChannels::SetEnabled(ENaughtyDebugChannel Channel, bool bEnabled)
+{
+    const uint32 Bit = 1u << (uint32)Channel;
+    if (bEnabled)
+    {
+        EnabledMask.fetch_or(Bit, std::memory_order_relaxed);
+    }
+    else
+    {
+        EnabledMask.fetch_and(~Bit, std::memory_order_relaxed);
+    }
+}
+
+void FNaughtyDebugChannels::SetAllEnabled(bool bEnabled)
+{
+    EnabledMask.store(bEnabled ? (1u << (uint32)ENaughtyDebugChannel::Num) - 1 : 0, std::memory_order_relaxed);
+}
+
+const TCHAR* FNaughtyDebugChannels::GetName(ENaughtyDebugChannel Channel)
+{
+    return Channel < ENaughtyDebugChannel::Num ? NaughtyDebugChannels::ChannelNames[(int32)Channel] : TEXT("Unknown");
+}
+
+bool FNaughtyDebugChannels::FindChannel(const FString& Name, ENaughtyDebugChannel& OutChannel)
+{
+    for (int32 Index = 0; Index < (int32)ENaughtyDebugChannel::Num; ++Index)
+    {
+        if (Name.Equals(NaughtyDebugChannels::ChannelNames[Index], ESearchCase::IgnoreCase))
+        {
+            OutChannel = (ENaughtyDebugChannel)Index;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FNaughtyDebugChannels::InitFromCommandLine()
+{
+    FString ChannelList;
+    if (!FParse::Value(FCommandLine::Get(), TEXT("NaughtyDebugChannels="), ChannelList, false))
+    {
+        return;
+    }
+
+    TArray<FString> Names;
+    ChannelList.ParseIntoArray(Names, TEXT(","));
+    for (const FString& Name : Names)
+    {
+        ENaughtyDebugChannel Channel;
+        if (Name.Equals(TEXT("all"), ESearchCase::IgnoreCase))
+        {
+            SetAllEnabled(true);
+        }
+        else if (FindChannel(Name, Channel))
+        {
+            SetEnabled(Channel, true);
+        }
+        else
+        {
+            UE_LOG(LogNaughtyShiba, Warning, TEXT("Unknown debug channel '%s'"), *Name);
+        }
+    }
+}
+
+void FNaughtyDebugChannels::Print(ENaughtyDebugChannel Channel, const FColor& Color, float Duration, const FString& Message)
+{
+    UE_LOG(LogNaughtyShiba, Log, TEXT("[%s] %s"), GetName(Channel), *Message);
+
+    if (NAUGHTY_WITH_SCREEN_DEBUG && GEngine)
+    {
+        GEngine->AddOnScreenDebugMessage(-1, Duration, Color, Message);
+    }
+}
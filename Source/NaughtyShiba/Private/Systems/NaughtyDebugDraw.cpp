@@ -0,0 +1,206 @@
+#include "Systems/NaughtyDebugDraw.h"
+#include "NaughtyShiba.h"
+#include "Systems/NaughtyProfiler.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/Canvas.h"
+#include "GameFramework/PlayerController.h"
+#include "Debug/DebugDrawService.h"
+
+bool UNaughtyDebugDrawSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if NAUGHTY_WITH_SCREEN_DEBUG
+    // Nothing to draw to on a dedicated server
+    return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+#else
+    return false;
+#endif
+}
+
+bool UNaughtyDebugDrawSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNaughtyDebugDrawSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    TextEntries.Reserve(MaxTextEntries);
+    Shapes.Reserve(MaxShapes);
+    LineScratch.Reserve(LineBudget);
+
+    DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UNaughtyDebugDrawSubsystem::DrawOverlay));
+}
+
+void UNaughtyDebugDrawSubsystem::Deinitialize()
+{
+    UDebugDrawService::Unregister(DrawHandle);
+    DrawHandle.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId UNaughtyDebugDrawSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNaughtyDebugDrawSubsystem, STATGROUP_Tickables);
+}
+
+UNaughtyDebugDrawSubsystem* UNaughtyDebugDrawSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UNaughtyDebugDrawSubsystem>() : nullptr;
+}
+
+void UNaughtyDebugDrawSubsystem::AddText(const FString& Message, const FColor& Color, float Duration, FName Key)
+{
+    const double ExpireTime = GetWorld()->GetRealTimeSeconds() + Duration;
+
+    // Same key, or same unkeyed text: refresh the existing line instead of adding another
+    FTextEntry* Existing = TextEntries.FindByPredicate([&Key, &Message](const FTextEntry& Entry)
+    {
+        return Key.IsNone() ? (Entry.Key.IsNone() && Entry.Message == Message) : Entry.Key == Key;
+    });
+
+    if (Existing)
+    {
+        Existing->Count = Key.IsNone() ? Existing->Count + 1 : 1;
+        Existing->Message = Message;
+        Existing->Color = Color;
+        Existing->ExpireTime = ExpireTime;
+        return;
+    }
+
+    // Full - the oldest line makes room
+    if (TextEntries.Num() >= MaxTextEntries)
+    {
+        TextEntries.RemoveAt(0, 1, false);
+    }
+
+    FTextEntry& Entry = TextEntries.AddDefaulted_GetRef();
+    Entry.Key = Key;
+    Entry.Message = Message;
+    Entry.Color = Color;
+    Entry.ExpireTime = ExpireTime;
+}
+
+void UNaughtyDebugDrawSubsystem::AddSphere(const FVector& Center, float Radius, const FColor& Color, float LifeTime, float Thickness)
+{
+    if (Shapes.Num() >= MaxShapes)
+    {
+        ++DroppedShapes;
+        return;
+    }
+    Shapes.Add({ Center, Radius, Color, LifeTime, Thickness, true });
+}
+
+void UNaughtyDebugDrawSubsystem::AddCircle(const FVector& Center, float Radius, const FColor& Color, float LifeTime, float Thickness)
+{
+    if (Shapes.Num() >= MaxShapes)
+    {
+        ++DroppedShapes;
+        return;
+    }
+    Shapes.Add({ Center, Radius, Color, LifeTime, Thickness, false });
+}
+
+void UNaughtyDebugDrawSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    NAUGHTY_PROFILE_SCOPE(Naughty_DebugDrawFlush);
+
+    FlushShapes();
+
+    const double Now = GetWorld()->GetRealTimeSeconds();
+    TextEntries.RemoveAll([Now](const FTextEntry& Entry) { return Entry.ExpireTime <= Now; });
+}
+
+void UNaughtyDebugDrawSubsystem::AddCircleLines(const FShape& Shape, const FVector& AxisX, const FVector& AxisY, int32 Segments)
+{
+    const FVector& Center = Shape.Center;
+    const float Radius = Shape.Radius;
+    const float AngleStep = 2.0f * PI / Segments;
+    FVector Previous = Center + AxisX * Radius;
+
+    for (int32 Segment = 1; Segment <= Segments; ++Segment)
+    {
+        float Sin, Cos;
+        FMath::SinCos(&Sin, &Cos, AngleStep * Segment);
+        const FVector Next = Center + (AxisX * Cos + AxisY * Sin) * Radius;
+
+        // Lifetime 0 is drawn this frame only; longer lifetimes are kept and expired by the line batcher
+        LineScratch.Emplace(Previous, Next, FLinearColor(Shape.Color), Shape.LifeTime, Shape.Thickness, SDPG_World);
+        Previous = Next;
+    }
+}
+
+void UNaughtyDebugDrawSubsystem::FlushShapes()
+{
+    LineScratch.Reset();
+
+    for (const FShape& Shape : Shapes)
+    {
+        const int32 Lines = Shape.bSphere ? SphereSegments * 3 : CircleSegments;
+        if (LineScratch.Num() + Lines > LineBudget)
+        {
+            ++DroppedShapes;
+            continue;
+        }
+
+        if (Shape.bSphere)
+        {
+            AddCircleLines(Shape, FVector::XAxisVector, FVector::YAxisVector, SphereSegments);
+            AddCircleLines(Shape, FVector::XAxisVector, FVector::ZAxisVector, SphereSegments);
+            AddCircleLines(Shape, FVector::YAxisVector, FVector::ZAxisVector, SphereSegments);
+        }
+        else
+        {
+            AddCircleLines(Shape, FVector::XAxisVector, FVector::YAxisVector, CircleSegments);
+        }
+    }
+
+    if (LineScratch.Num() > 0 && GetWorld()->LineBatcher)
+    {
+        GetWorld()->LineBatcher->DrawLines(LineScratch);
+    }
+
+    LastLineCount = LineScratch.Num();
+    LastDroppedShapes = DroppedShapes;
+    DroppedShapes = 0;
+    Shapes.Reset();
+}
+
+void UNaughtyDebugDrawSubsystem::DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController)
+{
+    if (!Canvas || !GEngine || (TextEntries.Num() == 0 && LastDroppedShapes == 0))
+    {
+        return;
+    }
+
+    // Every world's subsystem is called for every viewport; only draw this world's text into its own
+    if (!PlayerController || PlayerController->GetWorld() != GetWorld())
+    {
+        return;
+    }
+
+    UFont* Font = GEngine->GetSmallFont();
+    const float LineHeight = Font->GetMaxCharHeight() + 2.0f;
+    const float X = 20.0f;
+    float Y = 40.0f;
+
+    // Newest first, like the engine's on-screen messages
+    for (int32 Index = TextEntries.Num() - 1; Index >= 0; --Index)
+    {
+        const FTextEntry& Entry = TextEntries[Index];
+        Canvas->SetDrawColor(Entry.Color);
+        Canvas->DrawText(Font, Entry.Count > 1 ? FString::Printf(TEXT("%s (x%d)"), *Entry.Message, Entry.Count) : Entry.Message, X, Y);
+        Y += LineHeight;
+    }
+
+    if (LastDroppedShapes > 0)
+    {
+        Canvas->SetDrawColor(FColor::Red);
+        Canvas->DrawText(Font, FString::Printf(TEXT("Debug draw budget hit: %d shapes dropped"), LastDroppedShapes), X, Y);
+    }
+}
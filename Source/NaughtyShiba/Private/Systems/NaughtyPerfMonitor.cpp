@@ -0,0 +1,277 @@
+#include "Systems/NaughtyPerfMonitor.h"
+#include "NaughtyShiba.h"
+#include "Systems/NaughtyProfiler.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/Canvas.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerController.h"
+#include "Debug/DebugDrawService.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderCore.h"
+
+namespace NaughtyPerfMonitor
+{
+    static const TCHAR* const TierNames[] = { TEXT("Local"), TEXT("Near"), TEXT("Mid"), TEXT("Far"), TEXT("Culled") };
+
+    // Frame time graph
+    static constexpr int32 GraphSamples = 150;
+    static constexpr float GraphWidth = 300.0f;
+    static constexpr float GraphHeight = 60.0f;
+    static constexpr float GraphMaxMs = 50.0f;
+}
+
+bool UNaughtyPerfMonitor::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if NAUGHTY_PROFILING
+    return Super::ShouldCreateSubsystem(Outer);
+#else
+    return false;
+#endif
+}
+
+bool UNaughtyPerfMonitor::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNaughtyPerfMonitor::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Samples.SetNum(MaxSamples);
+    TimeUntilSample = SampleInterval;
+
+    for (int32 Category = 0; Category < (int32)ENaughtyProfileCategory::Num; ++Category)
+    {
+        LastCategoryCycles[Category] = FNaughtyProfiler::GetCategoryTotalCycles((ENaughtyProfileCategory)Category);
+    }
+}
+
+void UNaughtyPerfMonitor::Deinitialize()
+{
+    SetOverlayVisible(false);
+
+    Super::Deinitialize();
+}
+
+TStatId UNaughtyPerfMonitor::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNaughtyPerfMonitor, STATGROUP_Tickables);
+}
+
+UNaughtyPerfMonitor* UNaughtyPerfMonitor::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UNaughtyPerfMonitor>() : nullptr;
+}
+
+void UNaughtyPerfMonitor::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // GGameThreadTime/GRenderThreadTime hold the previous frame's busy cycles, as used by 'stat unit'
+    FrameMsSum += DeltaTime * 1000.0;
+    GameThreadMsSum += FPlatformTime::ToMilliseconds(GGameThreadTime);
+    RenderThreadMsSum += FPlatformTime::ToMilliseconds(GRenderThreadTime);
+    ++NumFrames;
+
+    TimeUntilSample -= DeltaTime;
+    if (TimeUntilSample <= 0.0f)
+    {
+        TakeSample();
+        TimeUntilSample += SampleInterval;
+
+        // Don't try to catch up after a hitch
+        TimeUntilSample = FMath::Max(TimeUntilSample, 0.0f);
+    }
+}
+
+double UNaughtyPerfMonitor::ConsumeSystemMs(ENaughtyProfileCategory Category)
+{
+    const uint64 Total = FNaughtyProfiler::GetCategoryTotalCycles(Category);
+    const uint64 Cycles = Total - LastCategoryCycles[(int32)Category];
+    LastCategoryCycles[(int32)Category] = Total;
+    return FPlatformTime::ToMilliseconds64(Cycles);
+}
+
+void UNaughtyPerfMonitor::TakeSample()
+{
+    if (NumFrames == 0)
+    {
+        return;
+    }
+
+    FNaughtyPerfSample& Sample = Samples[NextSample];
+    Sample = FNaughtyPerfSample();
+
+    Sample.TimeSeconds = GetWorld()->GetRealTimeSeconds();
+    Sample.FrameMs = FrameMsSum / NumFrames;
+    Sample.GameThreadMs = GameThreadMsSum / NumFrames;
+    Sample.RenderThreadMs = RenderThreadMsSum / NumFrames;
+
+    // Category totals are exclusive, so character logic driven from the movement callbacks is already out of
+    // movement, and nothing is taken out when the character ticks on its own
+    Sample.CharacterMs = ConsumeSystemMs(ENaughtyProfileCategory::Character) / NumFrames;
+    Sample.MovementMs = ConsumeSystemMs(ENaughtyProfileCategory::Movement) / NumFrames;
+    Sample.AnimationMs = ConsumeSystemMs(ENaughtyProfileCategory::Animation) / NumFrames;
+    Sample.UIMs = ConsumeSystemMs(ENaughtyProfileCategory::UI) / NumFrames;
+    Sample.SaveMs = ConsumeSystemMs(ENaughtyProfileCategory::Save) / NumFrames;
+
+    if (const UNetDriver* NetDriver = GetWorld()->GetNetDriver())
+    {
+        Sample.NetInKBps = NetDriver->InBytesPerSecond / 1024.0f;
+        Sample.NetOutKBps = NetDriver->OutBytesPerSecond / 1024.0f;
+    }
+
+    // Significance only runs on clients; servers report zero per tier
+    if (const UShibaSignificanceManager* Significance = GetWorld()->GetSubsystem<UShibaSignificanceManager>())
+    {
+        for (int32 Tier = 0; Tier < UE_ARRAY_COUNT(Sample.DogsPerTier); ++Tier)
+        {
+            Sample.DogsPerTier[Tier] = Significance->GetNumInTier((EShibaSignificanceTier)Tier);
+        }
+    }
+
+    NextSample = (NextSample + 1) % MaxSamples;
+    NumSamples = FMath::Min(NumSamples + 1, MaxSamples);
+
+    FrameMsSum = 0.0;
+    GameThreadMsSum = 0.0;
+    RenderThreadMsSum = 0.0;
+    NumFrames = 0;
+
+    if (bOverlayVisible)
+    {
+        RebuildOverlayText();
+    }
+}
+
+const FNaughtyPerfSample& UNaughtyPerfMonitor::GetSample(int32 Index) const
+{
+    check(Index >= 0 && Index < NumSamples);
+    return Samples[(NextSample - NumSamples + Index + MaxSamples) % MaxSamples];
+}
+
+void UNaughtyPerfMonitor::SetOverlayVisible(bool bVisible)
+{
+    if (bVisible == bOverlayVisible)
+    {
+        return;
+    }
+
+    bOverlayVisible = bVisible;
+
+    if (bOverlayVisible)
+    {
+        RebuildOverlayText();
+        DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UNaughtyPerfMonitor::DrawOverlay));
+    }
+    else
+    {
+        UDebugDrawService::Unregister(DrawHandle);
+        DrawHandle.Reset();
+        OverlayLines.Empty();
+    }
+}
+
+void UNaughtyPerfMonitor::RebuildOverlayText()
+{
+    using namespace NaughtyPerfMonitor;
+
+    OverlayLines.Reset();
+    if (NumSamples == 0)
+    {
+        OverlayLines.Add(TEXT("perfmon: waiting for samples"));
+        return;
+    }
+
+    const FNaughtyPerfSample& Sample = GetSample(NumSamples - 1);
+
+    OverlayLines.Add(FString::Printf(TEXT("Frame %.2f ms (%.0f fps)  Game %.2f  Render %.2f"),
+        Sample.FrameMs, Sample.FrameMs > 0.0f ? 1000.0f / Sample.FrameMs : 0.0f, Sample.GameThreadMs, Sample.RenderThreadMs));
+    OverlayLines.Add(FString::Printf(TEXT("Character %.3f  Movement %.3f  Anim %.3f  UI %.3f  Save %.3f ms"),
+        Sample.CharacterMs, Sample.MovementMs, Sample.AnimationMs, Sample.UIMs, Sample.SaveMs));
+    OverlayLines.Add(FString::Printf(TEXT("Net in %.1f KB/s  out %.1f KB/s"), Sample.NetInKBps, Sample.NetOutKBps));
+
+    FString Tiers = TEXT("Dogs");
+    for (int32 Tier = 0; Tier < UE_ARRAY_COUNT(Sample.DogsPerTier); ++Tier)
+    {
+        Tiers += FString::Printf(TEXT("  %s %d"), TierNames[Tier], Sample.DogsPerTier[Tier]);
+    }
+    OverlayLines.Add(Tiers);
+}
+
+void UNaughtyPerfMonitor::DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController)
+{
+    using namespace NaughtyPerfMonitor;
+
+    // The debug draw service calls every registered delegate for every viewport, including other PIE worlds
+    if (!Canvas || !GEngine || !PlayerController || PlayerController->GetWorld() != GetWorld())
+    {
+        return;
+    }
+
+    UFont* Font = GEngine->GetSmallFont();
+    const float LineHeight = Font->GetMaxCharHeight() + 2.0f;
+    const float X = 20.0f;
+    float Y = Canvas->ClipY * 0.25f;
+
+    Canvas->SetDrawColor(FColor::White);
+    for (const FString& Line : OverlayLines)
+    {
+        Canvas->DrawText(Font, Line, X, Y);
+        Y += LineHeight;
+    }
+
+    // Frame time history with 60 and 30 fps reference lines
+    const float GraphBottom = Y + 4.0f + GraphHeight;
+    const auto MsToY = [GraphBottom](float Ms) { return GraphBottom - FMath::Min(Ms / GraphMaxMs, 1.0f) * GraphHeight; };
+
+    Canvas->K2_DrawLine(FVector2D(X, MsToY(16.67f)), FVector2D(X + GraphWidth, MsToY(16.67f)), 1.0f, FLinearColor(0.0f, 0.5f, 0.0f));
+    Canvas->K2_DrawLine(FVector2D(X, MsToY(33.33f)), FVector2D(X + GraphWidth, MsToY(33.33f)), 1.0f, FLinearColor(0.5f, 0.5f, 0.0f));
+
+    const int32 NumPoints = FMath::Min(NumSamples, GraphSamples);
+    const float Step = GraphWidth / (GraphSamples - 1);
+    for (int32 Point = 1; Point < NumPoints; ++Point)
+    {
+        const FNaughtyPerfSample& Previous = GetSample(NumSamples - NumPoints + Point - 1);
+        const FNaughtyPerfSample& Current = GetSample(NumSamples - NumPoints + Point);
+        const FLinearColor Color = Current.FrameMs > 33.33f ? FLinearColor::Red : (Current.FrameMs > 16.67f ? FLinearColor::Yellow : FLinearColor::Green);
+
+        Canvas->K2_DrawLine(
+            FVector2D(X + (Point - 1) * Step, MsToY(Previous.FrameMs)),
+            FVector2D(X + Point * Step, MsToY(Current.FrameMs)),
+            1.0f, Color);
+    }
+}
+
+bool UNaughtyPerfMonitor::DumpCsv(const FString& FilePath) const
+{
+    using namespace NaughtyPerfMonitor;
+
+    FString Csv = TEXT("time_s,frame_ms,game_ms,render_ms,character_ms,movement_ms,anim_ms,ui_ms,save_ms,net_in_kbps,net_out_kbps");
+    for (const TCHAR* TierName : TierNames)
+    {
+        Csv += FString::Printf(TEXT(",dogs_%s"), *FString(TierName).ToLower());
+    }
+    Csv += TEXT("\n");
+
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        const FNaughtyPerfSample& Sample = GetSample(Index);
+        Csv += FString::Printf(TEXT("%.2f,%.3f,%.3f,%.3f,%.4f,%.4f,%.4f,%.4f,%.4f,%.2f,%.2f"),
+            Sample.TimeSeconds, Sample.FrameMs, Sample.GameThreadMs, Sample.RenderThreadMs,
+            Sample.CharacterMs, Sample.MovementMs, Sample.AnimationMs, Sample.UIMs, Sample.SaveMs,
+            Sample.NetInKBps, Sample.NetOutKBps);
+
+        for (int32 Count : Sample.DogsPerTier)
+        {
+            Csv += FString::Printf(TEXT(",%d"), Count);
+        }
+        Csv += TEXT("\n");
+    }
+
+    return FFileHelper::SaveStringToFile(Csv, *FilePath);
+}
@@ -0,0 +1,265 @@
+#include "Systems/NaughtyProfiler.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+
+FNaughtyProfiler::FZone FNaughtyProfiler::Zones[FNaughtyProfiler::MaxZones];
+std::atomic<int32> FNaughtyProfiler::NumZones{0};
+std::atomic<uint64> FNaughtyProfiler::CategoryCycles[(int32)ENaughtyProfileCategory::Num];
+std::atomic<int32> FNaughtyProfiler::ActiveHistogram{0};
+FCriticalSection FNaughtyProfiler::RegistryLock;
+
+namespace NaughtyProfiler
+{
+    static FTSTicker::FDelegateHandle PublishTickerHandle;
+
+    // Smallest bucket edge; buckets grow by 2^(1/4)
+    static constexpr double BaseBucketUs = 0.25;
+    static constexpr double BucketsPerOctave = 4.0;
+
+    // Open zones per category on this thread; only the outermost one adds to the category total
+    static thread_local uint16 CategoryDepth[(int32)ENaughtyProfileCategory::Num] = {};
+
+    // Categories with an open zone on this thread, innermost last (each appears once)
+    static thread_local uint8 OpenCategories[(int32)ENaughtyProfileCategory::Num] = {};
+    static thread_local int32 NumOpenCategories = 0;
+
+    // Cycles already billed to other categories from inside each open category
+    static thread_local uint64 NestedCategoryCycles[(int32)ENaughtyProfileCategory::Num] = {};
+}
+
+void FNaughtyProfiler::FHistogram::Clear()
+{
+    for (std::atomic<uint32>& Bucket : Buckets)
+    {
+        Bucket.store(0, std::memory_order_relaxed);
+    }
+    Count.store(0, std::memory_order_relaxed);
+    SumCycles.store(0, std::memory_order_relaxed);
+    MinCycles.store(MAX_uint64, std::memory_order_relaxed);
+    MaxCycles.store(0, std::memory_order_relaxed);
+}
+
+int32 FNaughtyProfiler::RegisterZone(FName Name, ENaughtyProfileCategory Category)
+{
+    FScopeLock Lock(&RegistryLock);
+
+    const int32 Num = NumZones.load(std::memory_order_relaxed);
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        if (Zones[Index].Name == Name)
+        {
+            ensureMsgf(Zones[Index].Category == Category, TEXT("Profile zone %s is declared with two categories"), *Name.ToString());
+            return Index;
+        }
+    }
+
+    if (Num >= MaxZones)
+    {
+        return INDEX_NONE;
+    }
+
+    FZone& Zone = Zones[Num];
+    Zone.Name = Name;
+    Zone.Category = Category;
+    Zone.Histograms[0].Clear();
+    Zone.Histograms[1].Clear();
+    Zone.Published = FNaughtyProfileZoneStats();
+    Zone.Published.Name = Name;
+
+    NumZones.store(Num + 1, std::memory_order_release);
+    return Num;
+}
+
+int32 FNaughtyProfiler::GetBucket(uint64 Cycles)
+{
+    using namespace NaughtyProfiler;
+
+    const double Us = FPlatformTime::ToSeconds64(Cycles) * 1000000.0;
+    if (Us <= BaseBucketUs)
+    {
+        return 0;
+    }
+
+    const int32 Bucket = FMath::FloorToInt32(FMath::Log2(Us / BaseBucketUs) * BucketsPerOctave);
+    return FMath::Clamp(Bucket, 0, NumBuckets - 1);
+}
+
+double FNaughtyProfiler::GetBucketUpperMs(int32 Bucket)
+{
+    using namespace NaughtyProfiler;
+    return BaseBucketUs * FMath::Pow(2.0, (Bucket + 1) / BucketsPerOctave) / 1000.0;
+}
+
+void FNaughtyProfiler::EnterZone(int32 ZoneId)
+{
+    if (ZoneId < 0 || ZoneId >= NumZones.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    using namespace NaughtyProfiler;
+
+    const int32 Category = (int32)Zones[ZoneId].Category;
+    if (Category != (int32)ENaughtyProfileCategory::None && CategoryDepth[Category]++ == 0)
+    {
+        OpenCategories[NumOpenCategories++] = static_cast<uint8>(Category);
+    }
+}
+
+void FNaughtyProfiler::Record(int32 ZoneId, uint64 Cycles)
+{
+    if (ZoneId < 0 || ZoneId >= NumZones.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    using namespace NaughtyProfiler;
+
+    // Categories are billed exclusively: time spent in a nested zone of another category (character logic
+    // driven from a movement callback) counts for that category only and is taken out of the enclosing one
+    const int32 Category = (int32)Zones[ZoneId].Category;
+    if (Category != (int32)ENaughtyProfileCategory::None && --CategoryDepth[Category] == 0)
+    {
+        // Scopes close in LIFO order, so this category is the innermost open one
+        --NumOpenCategories;
+
+        const uint64 NestedCycles = FMath::Min(NestedCategoryCycles[Category], Cycles);
+        NestedCategoryCycles[Category] = 0;
+        CategoryCycles[Category].fetch_add(Cycles - NestedCycles, std::memory_order_relaxed);
+
+        if (NumOpenCategories > 0)
+        {
+            NestedCategoryCycles[OpenCategories[NumOpenCategories - 1]] += Cycles;
+        }
+    }
+
+    RecordSpan(ZoneId, Cycles);
+}
+
+void FNaughtyProfiler::RecordSpan(int32 ZoneId, uint64 Cycles)
+{
+    if (ZoneId < 0 || ZoneId >= NumZones.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    FHistogram& Histogram = Zones[ZoneId].Histograms[ActiveHistogram.load(std::memory_order_relaxed)];
+
+    Histogram.Buckets[GetBucket(Cycles)].fetch_add(1, std::memory_order_relaxed);
+    Histogram.Count.fetch_add(1, std::memory_order_relaxed);
+    Histogram.SumCycles.fetch_add(Cycles, std::memory_order_relaxed);
+
+    uint64 Min = Histogram.MinCycles.load(std::memory_order_relaxed);
+    while (Cycles < Min && !Histogram.MinCycles.compare_exchange_weak(Min, Cycles, std::memory_order_relaxed))
+    {
+    }
+
+    uint64 Max = Histogram.MaxCycles.load(std::memory_order_relaxed);
+    while (Cycles > Max && !Histogram.MaxCycles.compare_exchange_weak(Max, Cycles, std::memory_order_relaxed))
+    {
+    }
+}
+
+void FNaughtyProfiler::PublishWindow()
+{
+    FScopeLock Lock(&RegistryLock);
+
+    // New samples go to the other histogram while this one is summarized
+    const int32 Finished = ActiveHistogram.load(std::memory_order_relaxed);
+    ActiveHistogram.store(1 - Finished, std::memory_order_relaxed);
+
+    const int32 Num = NumZones.load(std::memory_order_relaxed);
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        FZone& Zone = Zones[Index];
+        FHistogram& Histogram = Zone.Histograms[Finished];
+        FNaughtyProfileZoneStats& Stats = Zone.Published;
+
+        const uint64 Count = Histogram.Count.load(std::memory_order_relaxed);
+        Stats.Count = static_cast<int32>(Count);
+
+        if (Count > 0)
+        {
+            Stats.MinMs = FPlatformTime::ToMilliseconds64(Histogram.MinCycles.load(std::memory_order_relaxed));
+            Stats.MaxMs = FPlatformTime::ToMilliseconds64(Histogram.MaxCycles.load(std::memory_order_relaxed));
+            Stats.AvgMs = FPlatformTime::ToMilliseconds64(Histogram.SumCycles.load(std::memory_order_relaxed)) / Count;
+
+            // Percentiles resolve to the bucket's upper edge, capped by the real max
+            const uint64 P95Target = FMath::CeilToInt64(Count * 0.95);
+            const uint64 P99Target = FMath::CeilToInt64(Count * 0.99);
+            uint64 Cumulative = 0;
+            bool bHasP95 = false;
+
+            for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+            {
+                Cumulative += Histogram.Buckets[Bucket].load(std::memory_order_relaxed);
+                if (!bHasP95 && Cumulative >= P95Target)
+                {
+                    Stats.P95Ms = FMath::Min(GetBucketUpperMs(Bucket), Stats.MaxMs);
+                    bHasP95 = true;
+                }
+                if (Cumulative >= P99Target)
+                {
+                    Stats.P99Ms = FMath::Min(GetBucketUpperMs(Bucket), Stats.MaxMs);
+                    break;
+                }
+            }
+        }
+        else
+        {
+            Stats = FNaughtyProfileZoneStats();
+            Stats.Name = Zone.Name;
+        }
+
+        Histogram.Clear();
+    }
+}
+
+void FNaughtyProfiler::GetZoneStats(TArray<FNaughtyProfileZoneStats>& OutStats)
+{
+    FScopeLock Lock(&RegistryLock);
+
+    const int32 Num = NumZones.load(std::memory_order_relaxed);
+    OutStats.Reset(Num);
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        OutStats.Add(Zones[Index].Published);
+    }
+}
+
+uint64 FNaughtyProfiler::GetCategoryTotalCycles(ENaughtyProfileCategory Category)
+{
+    return CategoryCycles[(int32)Category].load(std::memory_order_relaxed);
+}
+
+void FNaughtyProfiler::Reset()
+{
+    FScopeLock Lock(&RegistryLock);
+
+    const int32 Num = NumZones.load(std::memory_order_relaxed);
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        FZone& Zone = Zones[Index];
+        Zone.Histograms[0].Clear();
+        Zone.Histograms[1].Clear();
+        Zone.Published = FNaughtyProfileZoneStats();
+        Zone.Published.Name = Zone.Name;
+    }
+}
+
+void FNaughtyProfiler::Startup()
+{
+    NaughtyProfiler::PublishTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateLambda([](float)
+        {
+            PublishWindow();
+            return true;
+        }),
+        1.0f);
+}
+
+void FNaughtyProfiler::Shutdown()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(NaughtyProfiler::PublishTickerHandle);
+    NaughtyProfiler::PublishTickerHandle.Reset();
+}
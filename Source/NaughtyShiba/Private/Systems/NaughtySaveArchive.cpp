@@ -0,0 +1,314 @@
+#include "Systems/NaughtySaveArchive.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+namespace NaughtySaveArchive
+{
+    // Sanity caps so a damaged header can't request a huge allocation
+    static constexpr int32 MaxPayloadSize = 64 * 1024 * 1024;
+    static constexpr int32 MaxSections = 16;
+
+    // Written in this order, so the small sections sit at the front of the file
+    static const ENaughtySaveSections SectionOrder[] =
+    {
+        ENaughtySaveSections::Info,
+        ENaughtySaveSections::Settings,
+        ENaughtySaveSections::Progress,
+        ENaughtySaveSections::World
+    };
+
+    struct FTocEntry
+    {
+        uint8 Section = 0;
+        int32 Offset = 0;
+        int32 StoredSize = 0;   // Equal to RawSize when the section didn't compress and is stored as-is
+        int32 RawSize = 0;
+
+        friend FArchive& operator<<(FArchive& Ar, FTocEntry& Entry)
+        {
+            return Ar << Entry.Section << Entry.Offset << Entry.StoredSize << Entry.RawSize;
+        }
+    };
+
+    static constexpr int32 TocEntrySize = sizeof(uint8) + 3 * sizeof(int32);
+
+    // Version 1 payload: everything in one blob
+    static void SerializeSnapshot(FArchive& Ar, FNaughtySaveSnapshot& Snapshot)
+    {
+        Ar << Snapshot.SaveSlotName;
+        Ar << Snapshot.SaveSlotIndex;
+        Ar << Snapshot.SaveTime;
+        Ar << Snapshot.SaveVersion;
+
+        FPlayerProgressData::StaticStruct()->SerializeItem(Ar, &Snapshot.PlayerProgress, nullptr);
+        FWorldStateData::StaticStruct()->SerializeItem(Ar, &Snapshot.WorldState, nullptr);
+        FGameSettings::StaticStruct()->SerializeItem(Ar, &Snapshot.GameSettings, nullptr);
+    }
+
+    // Structs use tagged properties so adding fields never breaks old saves
+    static void SerializeSection(FArchive& Ar, ENaughtySaveSections Section, FNaughtySaveSnapshot& Snapshot)
+    {
+        switch (Section)
+        {
+            case ENaughtySaveSections::Info:
+                // Play time and level are duplicated here so a save menu never has to open Progress or World
+                Ar << Snapshot.SaveSlotName;
+                Ar << Snapshot.SaveSlotIndex;
+                Ar << Snapshot.SaveTime;
+                Ar << Snapshot.SaveVersion;
+                Ar << Snapshot.PlayerProgress.TotalPlayTime;
+                Ar << Snapshot.WorldState.CurrentLevel;
+                break;
+
+            case ENaughtySaveSections::Settings:
+                FGameSettings::StaticStruct()->SerializeItem(Ar, &Snapshot.GameSettings, nullptr);
+                break;
+
+            case ENaughtySaveSections::Progress:
+                FPlayerProgressData::StaticStruct()->SerializeItem(Ar, &Snapshot.PlayerProgress, nullptr);
+                break;
+
+            case ENaughtySaveSections::World:
+                FWorldStateData::StaticStruct()->SerializeItem(Ar, &Snapshot.WorldState, nullptr);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    static bool DecodeVersion1(FMemoryReader& Header, const TArray<uint8>& Bytes, FNaughtySaveSnapshot& OutSnapshot)
+    {
+        int32 UncompressedSize = 0;
+        Header << UncompressedSize;
+
+        if (Header.IsError() || UncompressedSize <= 0 || UncompressedSize > MaxPayloadSize)
+        {
+            return false;
+        }
+
+        const int64 PayloadOffset = Header.Tell();
+        TArray<uint8> Payload;
+        Payload.SetNumUninitialized(UncompressedSize);
+        if (!FCompression::UncompressMemory(NAME_Zlib, Payload.GetData(), UncompressedSize, Bytes.GetData() + PayloadOffset, Bytes.Num() - PayloadOffset))
+        {
+            return false;
+        }
+
+        FMemoryReader Reader(Payload, true);
+        FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+        SerializeSnapshot(Ar, OutSnapshot);
+
+        OutSnapshot.Sections = ENaughtySaveSections::All;
+        return !Ar.IsError();
+    }
+}
+
+void FNaughtySaveArchive::Capture(const UNaughtySaveGame& SaveGame, FNaughtySaveSnapshot& OutSnapshot)
+{
+    OutSnapshot.Sections = ENaughtySaveSections::All;
+    OutSnapshot.SaveSlotName = SaveGame.SaveSlotName;
+    OutSnapshot.SaveSlotIndex = SaveGame.SaveSlotIndex;
+    OutSnapshot.SaveTime = SaveGame.SaveTime;
+    OutSnapshot.SaveVersion = SaveGame.SaveVersion;
+    OutSnapshot.PlayerProgress = SaveGame.PlayerProgress;
+    OutSnapshot.WorldState = SaveGame.WorldState;
+    OutSnapshot.GameSettings = SaveGame.GameSettings;
+}
+
+void FNaughtySaveArchive::Apply(const FNaughtySaveSnapshot& Snapshot, UNaughtySaveGame& SaveGame)
+{
+    if (EnumHasAnyFlags(Snapshot.Sections, ENaughtySaveSections::Info))
+    {
+        SaveGame.SaveSlotName = Snapshot.SaveSlotName;
+        SaveGame.SaveSlotIndex = Snapshot.SaveSlotIndex;
+        SaveGame.SaveTime = Snapshot.SaveTime;
+        SaveGame.SaveVersion = Snapshot.SaveVersion;
+        SaveGame.PlayerProgress.TotalPlayTime = Snapshot.PlayerProgress.TotalPlayTime;
+        SaveGame.WorldState.CurrentLevel = Snapshot.WorldState.CurrentLevel;
+    }
+    if (EnumHasAnyFlags(Snapshot.Sections, ENaughtySaveSections::Progress))
+    {
+        SaveGame.PlayerProgress = Snapshot.PlayerProgress;
+    }
+    if (EnumHasAnyFlags(Snapshot.Sections, ENaughtySaveSections::World))
+    {
+        SaveGame.WorldState = Snapshot.WorldState;
+    }
+    if (EnumHasAnyFlags(Snapshot.Sections, ENaughtySaveSections::Settings))
+    {
+        SaveGame.GameSettings = Snapshot.GameSettings;
+    }
+}
+
+bool FNaughtySaveArchive::Encode(const FNaughtySaveSnapshot& Snapshot, TArray<uint8>& OutBytes)
+{
+    using namespace NaughtySaveArchive;
+
+    constexpr int32 SectionCount = UE_ARRAY_COUNT(SectionOrder);
+    TArray<uint8> Stored[SectionCount];
+    FTocEntry Toc[SectionCount];
+
+    int32 Offset = 3 * sizeof(int32) + SectionCount * TocEntrySize;
+    for (int32 Index = 0; Index < SectionCount; ++Index)
+    {
+        TArray<uint8> Payload;
+        FMemoryWriter Writer(Payload, true);
+        FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+
+        // A saving archive only reads from the snapshot
+        SerializeSection(Ar, SectionOrder[Index], const_cast<FNaughtySaveSnapshot&>(Snapshot));
+
+        int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Payload.Num());
+        Stored[Index].SetNumUninitialized(CompressedSize);
+        if (!FCompression::CompressMemory(NAME_Zlib, Stored[Index].GetData(), CompressedSize, Payload.GetData(), Payload.Num()))
+        {
+            return false;
+        }
+
+        Toc[Index].Section = (uint8)SectionOrder[Index];
+        Toc[Index].Offset = Offset;
+        Toc[Index].RawSize = Payload.Num();
+
+        // Tiny sections (Info) can come out larger compressed
+        if (CompressedSize < Payload.Num())
+        {
+            Stored[Index].SetNum(CompressedSize, false);
+        }
+        else
+        {
+            Stored[Index] = MoveTemp(Payload);
+        }
+
+        Toc[Index].StoredSize = Stored[Index].Num();
+        Offset += Toc[Index].StoredSize;
+    }
+
+    uint32 Magic = FileMagic;
+    int32 Version = FormatVersion;
+    int32 Count = SectionCount;
+
+    OutBytes.Reset(Offset);
+    FMemoryWriter Header(OutBytes);
+    Header << Magic;
+    Header << Version;
+    Header << Count;
+    for (FTocEntry& Entry : Toc)
+    {
+        Header << Entry;
+    }
+    for (TArray<uint8>& Section : Stored)
+    {
+        Header.Serialize(Section.GetData(), Section.Num());
+    }
+
+    return true;
+}
+
+FNaughtySaveArchive::EDecodeResult FNaughtySaveArchive::Decode(const TArray<uint8>& Bytes, FNaughtySaveSnapshot& OutSnapshot, ENaughtySaveSections Sections)
+{
+    using namespace NaughtySaveArchive;
+
+    FMemoryReader Header(Bytes);
+
+    uint32 Magic = 0;
+    int32 Version = 0;
+    Header << Magic;
+
+    if (Magic != FileMagic)
+    {
+        return Bytes.Num() > 0 ? EDecodeResult::Legacy : EDecodeResult::Corrupt;
+    }
+
+    Header << Version;
+
+    if (Header.IsError() || Version <= 0 || Version > FormatVersion)
+    {
+        return EDecodeResult::Corrupt;
+    }
+
+    if (Version == 1)
+    {
+        return DecodeVersion1(Header, Bytes, OutSnapshot) ? EDecodeResult::Success : EDecodeResult::Corrupt;
+    }
+
+    int32 Count = 0;
+    Header << Count;
+    if (Header.IsError() || Count <= 0 || Count > MaxSections)
+    {
+        return EDecodeResult::Corrupt;
+    }
+
+    TArray<FTocEntry, TInlineAllocator<MaxSections>> Toc;
+    Toc.SetNum(Count);
+    for (FTocEntry& Entry : Toc)
+    {
+        Header << Entry;
+    }
+    if (Header.IsError())
+    {
+        return EDecodeResult::Corrupt;
+    }
+
+    OutSnapshot.Sections = ENaughtySaveSections::None;
+
+    TArray<uint8> Payload;
+    for (const FTocEntry& Entry : Toc)
+    {
+        const ENaughtySaveSections Section = (ENaughtySaveSections)Entry.Section;
+
+        // Unknown sections come from newer builds and are skipped like any section not asked for
+        if (!FMath::IsPowerOfTwo(Entry.Section) || !EnumHasAnyFlags(Sections & ENaughtySaveSections::All, Section))
+        {
+            continue;
+        }
+
+        if (Entry.Offset < 0 || Entry.StoredSize <= 0 || (int64)Entry.Offset + Entry.StoredSize > Bytes.Num()
+            || Entry.RawSize <= 0 || Entry.RawSize > MaxPayloadSize)
+        {
+            return EDecodeResult::Corrupt;
+        }
+
+        const uint8* Stored = Bytes.GetData() + Entry.Offset;
+        if (Entry.StoredSize == Entry.RawSize)
+        {
+            Payload = TArray<uint8>(Stored, Entry.StoredSize);
+        }
+        else
+        {
+            Payload.SetNumUninitialized(Entry.RawSize, false);
+            if (!FCompression::UncompressMemory(NAME_Zlib, Payload.GetData(), Entry.RawSize, Stored, Entry.StoredSize))
+            {
+                return EDecodeResult::Corrupt;
+            }
+        }
+
+        FMemoryReader Reader(Payload, true);
+        FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+        SerializeSection(Ar, Section, OutSnapshot);
+
+        if (Ar.IsError())
+        {
+            return EDecodeResult::Corrupt;
+        }
+        OutSnapshot.Sections |= Section;
+    }
+
+    return EDecodeResult::Success;
+}
+
+bool FNaughtySaveArchive::WriteSlot(const FString& SlotName, int32 SlotIndex, const TArray<uint8>& Bytes)
+{
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    return SaveSystem && SaveSystem->SaveGame(false, *SlotName, SlotIndex, Bytes);
+}
+
+bool FNaughtySaveArchive::ReadSlot(const FString& SlotName, int32 SlotIndex, TArray<uint8>& OutBytes)
+{
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    return SaveSystem && SaveSystem->LoadGame(false, *SlotName, SlotIndex, OutBytes);
+}
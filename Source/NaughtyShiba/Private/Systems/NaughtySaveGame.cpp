@@ -1,8 +1,9 @@
 #include "Systems/NaughtySaveGame.h"
+#include "Systems/NaughtySaveIdRegistry.h"
 #include "Engine/Engine.h"
 #include "Misc/DateTime.h"
 
-const FString UNaughtySaveGame::CURRENT_SAVE_VERSION = TEXT("1.0.0");
+const FString UNaughtySaveGame::CURRENT_SAVE_VERSION = TEXT("1.2.0");
 
 UNaughtySaveGame::UNaughtySaveGame()
 {
@@ -95,13 +96,229 @@ void UNaughtySaveGame::ValidateData()
     {
         GameSettings.ScreenResolution = FIntPoint(1920, 1080);
     }
+
+    // The registry only ever grows, so names saved as strings may have an ID by now
+    PlayerProgress.MigrateToIds();
+    WorldState.MigrateToIds();
 }
 
 void UNaughtySaveGame::MigrateFromOldVersion(const FString& OldVersion)
 {
-    // Future implementation for save data migration
-    // For now, just update the version
+    // 1.0.0 -> 1.1.0: sectioned file format only; the data itself is unchanged and is rewritten sectioned on the next save
+    // 1.1.0 -> 1.2.0: registered names move into ID bitsets, which ValidateData does on every load
     SaveVersion = CURRENT_SAVE_VERSION;
     
     UE_LOG(LogTemp, Warning, TEXT("Save data migrated from version %s to %s"), *OldVersion, *CURRENT_SAVE_VERSION);
-}
\ No newline at end of file
+}
+
+bool FNaughtyIdBitset::Add(int32 Id)
+{
+    check(Id >= 0);
+
+    const int32 WordIndex = Id >> 5;
+    if (WordIndex >= Words.Num())
+    {
+        Words.SetNumZeroed(WordIndex + 1);
+    }
+
+    const uint32 Mask = 1u << (Id & 31);
+    const bool bAdded = (Words[WordIndex] & Mask) == 0;
+    Words[WordIndex] |= Mask;
+    return bAdded;
+}
+
+void FNaughtyIdBitset::Remove(int32 Id)
+{
+    if (Id >= 0 && Words.IsValidIndex(Id >> 5))
+    {
+        Words[Id >> 5] &= ~(1u << (Id & 31));
+    }
+}
+
+int32 FNaughtyIdBitset::Num() const
+{
+    int32 Count = 0;
+    for (uint32 Word : Words)
+    {
+        Count += FMath::CountBits(Word);
+    }
+    return Count;
+}
+
+namespace NaughtySaveIds
+{
+    static int32 FindId(ENaughtySaveIdDomain Domain, const FString& Name)
+    {
+        const UNaughtySaveIdRegistry* Registry = UNaughtySaveIdRegistry::Get();
+        return Registry ? Registry->FindId(Domain, Name) : INDEX_NONE;
+    }
+
+    // Registered names move to the bitset; the rest stay as strings
+    static void MigrateNames(ENaughtySaveIdDomain Domain, TArray<FString>& Names, FNaughtyIdBitset& Ids)
+    {
+        Names.RemoveAll([Domain, &Ids](const FString& Name)
+        {
+            const int32 Id = FindId(Domain, Name);
+            if (Id == INDEX_NONE)
+            {
+                return false;
+            }
+            Ids.Add(Id);
+            return true;
+        });
+    }
+
+    // Calls Visit(Id, Name) for each ID in the set; IDs the current registry doesn't know are skipped
+    template<typename VisitorType>
+    static void ForEachName(ENaughtySaveIdDomain Domain, const FNaughtyIdBitset& Ids, VisitorType&& Visit)
+    {
+        const UNaughtySaveIdRegistry* Registry = UNaughtySaveIdRegistry::Get();
+        if (!Registry)
+        {
+            return;
+        }
+
+        for (int32 Id = 0; Id < Ids.Words.Num() * 32; ++Id)
+        {
+            if (Ids.Contains(Id))
+            {
+                const FName Name = Registry->GetIdName(Domain, Id);
+                if (!Name.IsNone())
+                {
+                    Visit(Id, Name.ToString());
+                }
+            }
+        }
+    }
+
+    static TArray<FString> MergeNames(ENaughtySaveIdDomain Domain, const FNaughtyIdBitset& Ids, const TArray<FString>& Names)
+    {
+        TArray<FString> Merged;
+        Merged.Reserve(Ids.Num() + Names.Num());
+        ForEachName(Domain, Ids, [&Merged](int32 Id, FString&& Name) { Merged.Add(MoveTemp(Name)); });
+        Merged.Append(Names);
+        return Merged;
+    }
+}
+
+bool FPlayerProgressData::IsAreaUnlocked(const FString& AreaName) const
+{
+    const int32 Id = NaughtySaveIds::FindId(ENaughtySaveIdDomain::Area, AreaName);
+    return Id != INDEX_NONE ? UnlockedAreaIds.Contains(Id) : UnlockedAreas.Contains(AreaName);
+}
+
+bool FPlayerProgressData::IsMissionCompleted(const FString& MissionName) const
+{
+    const int32 Id = NaughtySaveIds::FindId(ENaughtySaveIdDomain::Mission, MissionName);
+    return Id != INDEX_NONE ? CompletedMissionIds.Contains(Id) : CompletedMissions.Contains(MissionName);
+}
+
+bool FPlayerProgressData::UnlockArea(const FString& AreaName)
+{
+    const int32 Id = NaughtySaveIds::FindId(ENaughtySaveIdDomain::Area, AreaName);
+    if (Id != INDEX_NONE)
+    {
+        return UnlockedAreaIds.Add(Id);
+    }
+
+    const int32 PreviousNum = UnlockedAreas.Num();
+    return UnlockedAreas.AddUnique(AreaName) == PreviousNum;
+}
+
+bool FPlayerProgressData::CompleteMission(const FString& MissionName)
+{
+    const int32 Id = NaughtySaveIds::FindId(ENaughtySaveIdDomain::Mission, MissionName);
+    if (Id != INDEX_NONE)
+    {
+        return CompletedMissionIds.Add(Id);
+    }
+
+    const int32 PreviousNum = CompletedMissions.Num();
+    return CompletedMissions.AddUnique(MissionName) == PreviousNum;
+}
+
+TArray<FString> FPlayerProgressData::GetUnlockedAreas() const
+{
+    return NaughtySaveIds::MergeNames(ENaughtySaveIdDomain::Area, UnlockedAreaIds, UnlockedAreas);
+}
+
+TArray<FString> FPlayerProgressData::GetCompletedMissions() const
+{
+    return NaughtySaveIds::MergeNames(ENaughtySaveIdDomain::Mission, CompletedMissionIds, CompletedMissions);
+}
+
+void FPlayerProgressData::MigrateToIds()
+{
+    NaughtySaveIds::MigrateNames(ENaughtySaveIdDomain::Area, UnlockedAreas, UnlockedAreaIds);
+    NaughtySaveIds::MigrateNames(ENaughtySaveIdDomain::Mission, CompletedMissions, CompletedMissionIds);
+}
+
+bool FWorldStateData::GetWorldObjectState(const FString& ObjectName, bool& bOutState) const
+{
+    const int32 Id = NaughtySaveIds::FindId(ENaughtySaveIdDomain::WorldObject, ObjectName);
+    if (Id != INDEX_NONE)
+    {
+        bOutState = WorldObjectStates.Contains(Id);
+        return WorldObjectIds.Contains(Id);
+    }
+
+    const bool* State = WorldObjects.Find(ObjectName);
+    bOutState = State && *State;
+    return State != nullptr;
+}
+
+bool FWorldStateData::SetWorldObjectState(const FString& ObjectName, bool bState)
+{
+    const int32 Id = NaughtySaveIds::FindId(ENaughtySaveIdDomain::WorldObject, ObjectName);
+    if (Id != INDEX_NONE)
+    {
+        const bool bChanged = WorldObjectIds.Add(Id) || WorldObjectStates.Contains(Id) != bState;
+        if (bState)
+        {
+            WorldObjectStates.Add(Id);
+        }
+        else
+        {
+            WorldObjectStates.Remove(Id);
+        }
+        return bChanged;
+    }
+
+    const bool* Existing = WorldObjects.Find(ObjectName);
+    const bool bChanged = !Existing || *Existing != bState;
+    WorldObjects.Add(ObjectName, bState);
+    return bChanged;
+}
+
+TMap<FString, bool> FWorldStateData::GetWorldObjectStates() const
+{
+    TMap<FString, bool> Merged(WorldObjects);
+    NaughtySaveIds::ForEachName(ENaughtySaveIdDomain::WorldObject, WorldObjectIds, [this, &Merged](int32 Id, FString&& Name)
+    {
+        Merged.Add(MoveTemp(Name), WorldObjectStates.Contains(Id));
+    });
+    return Merged;
+}
+
+void FWorldStateData::MigrateToIds()
+{
+    for (auto It = WorldObjects.CreateIterator(); It; ++It)
+    {
+        const int32 Id = NaughtySaveIds::FindId(ENaughtySaveIdDomain::WorldObject, It.Key());
+        if (Id == INDEX_NONE)
+        {
+            continue;
+        }
+
+        WorldObjectIds.Add(Id);
+        if (It.Value())
+        {
+            WorldObjectStates.Add(Id);
+        }
+        else
+        {
+            WorldObjectStates.Remove(Id);
+        }
+        It.RemoveCurrent();
+    }
+}
@@ -0,0 +1,100 @@
+#include "Systems/NaughtySaveIdRegistry.h"
+#include "NaughtyShiba.h"
+
+const UNaughtySaveIdRegistry* UNaughtySaveIdRegistry::ActiveRegistry = nullptr;
+
+int32 UNaughtySaveIdRegistry::FindId(ENaughtySaveIdDomain Domain, const FString& Name) const
+{
+    // FNAME_Find: a name nobody ever created can't be registered, and looking it up shouldn't add it to the name table
+    const FName Key(*Name, FNAME_Find);
+    if (Key.IsNone())
+    {
+        return INDEX_NONE;
+    }
+
+    const int32* Id = Lookup[(int32)Domain].Find(Key);
+    return Id ? *Id : INDEX_NONE;
+}
+
+FName UNaughtySaveIdRegistry::GetIdName(ENaughtySaveIdDomain Domain, int32 Id) const
+{
+    const TArray<FName>& Names = GetNames(Domain);
+    return Names.IsValidIndex(Id) ? Names[Id] : NAME_None;
+}
+
+void UNaughtySaveIdRegistry::SetActive(const UNaughtySaveIdRegistry* Registry)
+{
+    check(IsInGameThread());
+    ActiveRegistry = Registry;
+}
+
+void UNaughtySaveIdRegistry::ClearActive(const UNaughtySaveIdRegistry* Registry)
+{
+    check(IsInGameThread());
+    if (ActiveRegistry == Registry)
+    {
+        ActiveRegistry = nullptr;
+    }
+}
+
+void UNaughtySaveIdRegistry::PostLoad()
+{
+    Super::PostLoad();
+
+    BuildLookup();
+}
+
+void UNaughtySaveIdRegistry::BeginDestroy()
+{
+    // Never leave save code holding a registry the GC is about to free
+    ClearActive(this);
+
+    Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UNaughtySaveIdRegistry::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    BuildLookup();
+}
+#endif
+
+const TArray<FName>& UNaughtySaveIdRegistry::GetNames(ENaughtySaveIdDomain Domain) const
+{
+    switch (Domain)
+    {
+        case ENaughtySaveIdDomain::Area:
+            return Areas;
+        case ENaughtySaveIdDomain::Mission:
+            return Missions;
+        default:
+            return WorldObjects;
+    }
+}
+
+void UNaughtySaveIdRegistry::BuildLookup()
+{
+    for (int32 Domain = 0; Domain < (int32)ENaughtySaveIdDomain::Num; ++Domain)
+    {
+        const TArray<FName>& Names = GetNames((ENaughtySaveIdDomain)Domain);
+        TMap<FName, int32>& DomainLookup = Lookup[Domain];
+
+        DomainLookup.Reset();
+        DomainLookup.Reserve(Names.Num());
+
+        for (int32 Id = 0; Id < Names.Num(); ++Id)
+        {
+            // First entry wins, so a duplicate added later never moves an existing ID
+            if (!Names[Id].IsNone() && !DomainLookup.Contains(Names[Id]))
+            {
+                DomainLookup.Add(Names[Id], Id);
+            }
+            else
+            {
+                UE_LOG(LogNaughtyShiba, Warning, TEXT("%s: entry %d (%s) is empty or a duplicate and gets no save ID"), *GetName(), Id, *Names[Id].ToString());
+            }
+        }
+    }
+}
@@ -0,0 +1,296 @@
+#include "Systems/NaughtySaveJournal.h"
+#include "NaughtyShiba.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+namespace NaughtySaveJournal
+{
+    // Blocks larger than this are treated as a torn write
+    static constexpr int32 MaxBlockSize = 16 * 1024 * 1024;
+
+    template<typename... ArgTypes>
+    static void WriteRecord(TArray<uint8>& Records, FNaughtySaveJournal::ERecord Type, ArgTypes&... Args)
+    {
+        FMemoryWriter Writer(Records, true, true);
+        uint8 TypeByte = (uint8)Type;
+        Writer << TypeByte;
+        (Writer << ... << Args);
+    }
+}
+
+void FNaughtySaveJournal::RecordUnlockArea(const FString& AreaName)
+{
+    FString Name = AreaName;
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::UnlockArea, Name);
+}
+
+void FNaughtySaveJournal::RecordCompleteMission(const FString& MissionName)
+{
+    FString Name = MissionName;
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::CompleteMission, Name);
+}
+
+void FNaughtySaveJournal::RecordTerritoryMarker(const FVector& Location)
+{
+    FVector Marker = Location;
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::AddTerritoryMarker, Marker);
+}
+
+void FNaughtySaveJournal::RecordNPCReputation(const FString& NPCName, int32 ReputationChange)
+{
+    FString Name = NPCName;
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::UpdateNPCReputation, Name, ReputationChange);
+}
+
+void FNaughtySaveJournal::RecordWorldObjectState(const FString& ObjectName, bool bState)
+{
+    FString Name = ObjectName;
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::SetWorldObjectState, Name, bState);
+}
+
+void FNaughtySaveJournal::RecordPlayerProgress(float Courage, int32 Barks, int32 Territories)
+{
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::SetPlayerProgress, Courage, Barks, Territories);
+}
+
+void FNaughtySaveJournal::RecordPlayTime(float TotalPlayTime)
+{
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::SetPlayTime, TotalPlayTime);
+}
+
+void FNaughtySaveJournal::RecordSaveTime(const FDateTime& SaveTime)
+{
+    FDateTime Time = SaveTime;
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::SetSaveTime, Time);
+}
+
+void FNaughtySaveJournal::RecordSessionState(float MaxCourage, const FString& LastSaveLocation, const FString& CurrentLevel)
+{
+    FString Location = LastSaveLocation;
+    FString Level = CurrentLevel;
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::SetSessionState, MaxCourage, Location, Level);
+}
+
+void FNaughtySaveJournal::RecordGameSettings(const FGameSettings& Settings)
+{
+    NaughtySaveJournal::WriteRecord(PendingRecords, ERecord::SetGameSettings);
+
+    FMemoryWriter Writer(PendingRecords, true, true);
+    FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+    FGameSettings::StaticStruct()->SerializeItem(Ar, const_cast<FGameSettings*>(&Settings), nullptr);
+}
+
+TArray<uint8> FNaughtySaveJournal::TakePendingRecords()
+{
+    return MoveTemp(PendingRecords);
+}
+
+FString FNaughtySaveJournal::GetJournalPath(const FString& SlotName, int32 SlotIndex)
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / FString::Printf(TEXT("%s_%d.journal"), *SlotName, SlotIndex);
+}
+
+bool FNaughtySaveJournal::ResetFile(const FString& SlotName, int32 SlotIndex, int64 Generation)
+{
+    TArray<uint8> Header;
+    FMemoryWriter Writer(Header);
+
+    uint32 Magic = FileMagic;
+    int32 Version = FormatVersion;
+    Writer << Magic;
+    Writer << Version;
+    Writer << Generation;
+
+    return FFileHelper::SaveArrayToFile(Header, *GetJournalPath(SlotName, SlotIndex));
+}
+
+bool FNaughtySaveJournal::AppendBlock(const FString& SlotName, int32 SlotIndex, const TArray<uint8>& Records)
+{
+    TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*GetJournalPath(SlotName, SlotIndex), FILEWRITE_Append));
+    if (!File)
+    {
+        return false;
+    }
+
+    // Length prefix lets replay detect a block cut short by a crash
+    int32 BlockSize = Records.Num();
+    *File << BlockSize;
+    File->Serialize(const_cast<uint8*>(Records.GetData()), BlockSize);
+
+    return File->Close();
+}
+
+void FNaughtySaveJournal::DeleteFile(const FString& SlotName, int32 SlotIndex)
+{
+    IFileManager::Get().Delete(*GetJournalPath(SlotName, SlotIndex), false, false, true);
+}
+
+int64 FNaughtySaveJournal::Replay(const FString& SlotName, int32 SlotIndex, int64 Generation, FNaughtySaveSnapshot& Snapshot, bool* bOutTornTail)
+{
+    if (bOutTornTail)
+    {
+        *bOutTornTail = false;
+    }
+
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetJournalPath(SlotName, SlotIndex), FILEREAD_Silent))
+    {
+        return INDEX_NONE;
+    }
+
+    FMemoryReader Reader(Bytes);
+    uint32 Magic = 0;
+    int32 Version = 0;
+    int64 JournalGeneration = 0;
+    Reader << Magic;
+    Reader << Version;
+    Reader << JournalGeneration;
+
+    // Left over from an older snapshot - everything in it is already in (or superseded by) the base
+    if (Reader.IsError() || Magic != FileMagic || Version < 1 || Version > FormatVersion || JournalGeneration != Generation)
+    {
+        return INDEX_NONE;
+    }
+
+    TArray<uint8> Block;
+    int64 ValidBytes = Reader.Tell();
+    while (Reader.Tell() + (int64)sizeof(int32) <= Bytes.Num())
+    {
+        int32 BlockSize = 0;
+        Reader << BlockSize;
+
+        if (BlockSize < 0 || BlockSize > NaughtySaveJournal::MaxBlockSize || Reader.Tell() + BlockSize > Bytes.Num())
+        {
+            break;
+        }
+
+        Block.SetNumUninitialized(BlockSize, false);
+        Reader.Serialize(Block.GetData(), BlockSize);
+        ApplyRecords(Block, Snapshot);
+        ValidBytes = Reader.Tell();
+    }
+
+    // Also catches a length prefix cut short
+    if (ValidBytes < Bytes.Num())
+    {
+        UE_LOG(LogNaughtyShiba, Warning, TEXT("Save journal %s [%d] ends in a partial block; ignoring its last %lld bytes"), *SlotName, SlotIndex, Bytes.Num() - ValidBytes);
+        if (bOutTornTail)
+        {
+            *bOutTornTail = true;
+        }
+    }
+
+    return ValidBytes;
+}
+
+void FNaughtySaveJournal::ApplyRecords(const TArray<uint8>& Block, FNaughtySaveSnapshot& Snapshot)
+{
+    FMemoryReader Reader(Block);
+
+    while (!Reader.AtEnd() && !Reader.IsError())
+    {
+        uint8 TypeByte = 0;
+        Reader << TypeByte;
+
+        FString Name;
+        switch ((ERecord)TypeByte)
+        {
+            case ERecord::UnlockArea:
+                Reader << Name;
+                Snapshot.PlayerProgress.UnlockArea(Name);
+                break;
+
+            case ERecord::CompleteMission:
+                Reader << Name;
+                Snapshot.PlayerProgress.CompleteMission(Name);
+                break;
+
+            case ERecord::AddTerritoryMarker:
+            {
+                FVector Location;
+                Reader << Location;
+                Snapshot.WorldState.TerritoryMarkers.Add(Location);
+                break;
+            }
+
+            case ERecord::UpdateNPCReputation:
+            {
+                int32 Change = 0;
+                Reader << Name << Change;
+                Snapshot.WorldState.NPCReputation.FindOrAdd(Name) += Change;
+                break;
+            }
+
+            case ERecord::SetWorldObjectState:
+            {
+                bool bState = false;
+                Reader << Name << bState;
+                Snapshot.WorldState.SetWorldObjectState(Name, bState);
+                break;
+            }
+
+            case ERecord::SetPlayerProgress:
+                Reader << Snapshot.PlayerProgress.CourageLevel << Snapshot.PlayerProgress.TotalBarks << Snapshot.PlayerProgress.TerritoriesMarked;
+                break;
+
+            case ERecord::SetPlayTime:
+                Reader << Snapshot.PlayerProgress.TotalPlayTime;
+                break;
+
+            case ERecord::SetSaveTime:
+                Reader << Snapshot.SaveTime;
+                Snapshot.WorldState.LastSaveTime = Snapshot.SaveTime;
+                break;
+
+            case ERecord::SetSessionState:
+                Reader << Snapshot.PlayerProgress.MaxCourage << Snapshot.PlayerProgress.LastSaveLocation << Snapshot.WorldState.CurrentLevel;
+                break;
+
+            case ERecord::SetGameSettings:
+            {
+                FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+                FGameSettings::StaticStruct()->SerializeItem(Ar, &Snapshot.GameSettings, nullptr);
+                break;
+            }
+
+            default:
+                UE_LOG(LogNaughtyShiba, Warning, TEXT("Unknown save journal record %d; skipping the rest of the block"), TypeByte);
+                return;
+        }
+    }
+}
+
+int64 FNaughtySaveJournal::Compact(const FString& SlotName, int32 SlotIndex, int64 Generation, int64* OutSnapshotBytes)
+{
+    TArray<uint8> Bytes;
+    FNaughtySaveSnapshot Snapshot;
+    if (!FNaughtySaveArchive::ReadSlot(SlotName, SlotIndex, Bytes)
+        || FNaughtySaveArchive::Decode(Bytes, Snapshot) != FNaughtySaveArchive::EDecodeResult::Success
+        || GetGeneration(Snapshot) != Generation
+        || Replay(SlotName, SlotIndex, Generation, Snapshot) == INDEX_NONE)
+    {
+        return 0;
+    }
+
+    // The new snapshot needs a generation of its own so the old journal can never apply to it
+    Snapshot.SaveTime = FDateTime(FMath::Max(Snapshot.SaveTime.GetTicks(), Generation + 1));
+    Snapshot.WorldState.LastSaveTime = Snapshot.SaveTime;
+
+    TArray<uint8> Compacted;
+    if (!FNaughtySaveArchive::Encode(Snapshot, Compacted) || !FNaughtySaveArchive::WriteSlot(SlotName, SlotIndex, Compacted))
+    {
+        return 0;
+    }
+
+    if (OutSnapshotBytes)
+    {
+        *OutSnapshotBytes = Compacted.Num();
+    }
+
+    const int64 NewGeneration = GetGeneration(Snapshot);
+    return ResetFile(SlotName, SlotIndex, NewGeneration) ? NewGeneration : INDEX_NONE;
+}
@@ -0,0 +1,218 @@
+#include "Systems/NaughtySaveSlotIndex.h"
+#include "Systems/NaughtySaveArchive.h"
+#include "Systems/NaughtySaveGame.h"
+#include "NaughtyShiba.h"
+#include "HAL/FileManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+FNaughtySaveSlotInfo FNaughtySaveSlotInfo::Make(const FNaughtySaveSnapshot& Snapshot, int64 SizeBytes)
+{
+    FNaughtySaveSlotInfo Info;
+    Info.SlotName = Snapshot.SaveSlotName;
+    Info.SlotIndex = Snapshot.SaveSlotIndex;
+    Info.SaveTime = Snapshot.SaveTime;
+    Info.PlayTimeHours = Snapshot.PlayerProgress.TotalPlayTime / 3600.0f;
+    Info.CurrentLevel = Snapshot.WorldState.CurrentLevel;
+    Info.SaveVersion = Snapshot.SaveVersion;
+    Info.SizeBytes = SizeBytes;
+    return Info;
+}
+
+FNaughtySaveSlotInfo FNaughtySaveSlotInfo::Make(const UNaughtySaveGame& SaveGame, int64 SizeBytes)
+{
+    FNaughtySaveSlotInfo Info;
+    Info.SlotName = SaveGame.SaveSlotName;
+    Info.SlotIndex = SaveGame.SaveSlotIndex;
+    Info.SaveTime = SaveGame.SaveTime;
+    Info.PlayTimeHours = SaveGame.GetPlayTimeHours();
+    Info.CurrentLevel = SaveGame.WorldState.CurrentLevel;
+    Info.SaveVersion = SaveGame.SaveVersion;
+    Info.SizeBytes = SizeBytes;
+    return Info;
+}
+
+FArchive& operator<<(FArchive& Ar, FNaughtySaveSlotInfo& Info)
+{
+    return Ar << Info.SlotName << Info.SlotIndex << Info.SaveTime << Info.PlayTimeHours << Info.CurrentLevel << Info.SaveVersion << Info.SizeBytes;
+}
+
+FString FNaughtySaveSlotIndex::GetIndexPath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("SlotIndex.dat");
+}
+
+void FNaughtySaveSlotIndex::Load()
+{
+    FScopeLock ScopeLock(&Lock);
+
+    Slots.Reset();
+
+    TArray<uint8> Bytes;
+    if (FFileHelper::LoadFileToArray(Bytes, *GetIndexPath(), FILEREAD_Silent))
+    {
+        FMemoryReader Reader(Bytes);
+        uint32 Magic = 0;
+        int32 Version = 0;
+        Reader << Magic;
+        Reader << Version;
+
+        if (Magic == FileMagic && Version == FormatVersion)
+        {
+            Reader << Slots;
+        }
+
+        if (Reader.IsError() || Magic != FileMagic || Version != FormatVersion)
+        {
+            UE_LOG(LogNaughtyShiba, Warning, TEXT("Save slot index is unreadable; rebuilding it"));
+            Slots.Reset();
+        }
+    }
+
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    TArray<FString> SlotNames;
+    if (!SaveSystem || !SaveSystem->GetSaveGameNames(SlotNames, 0))
+    {
+        // Platform can't list its saves - trust the index as it is
+        return;
+    }
+
+    bool bChanged = Slots.RemoveAll([&SlotNames](const FNaughtySaveSlotInfo& Info) { return !SlotNames.Contains(Info.SlotName); }) > 0;
+
+    // Slots the index doesn't know yet are opened once (info section only) and remembered from then on
+    for (const FString& SlotName : SlotNames)
+    {
+        if (Slots.ContainsByPredicate([&SlotName](const FNaughtySaveSlotInfo& Info) { return Info.SlotName == SlotName; }))
+        {
+            continue;
+        }
+
+        TArray<uint8> SlotBytes;
+        if (!FNaughtySaveArchive::ReadSlot(SlotName, 0, SlotBytes))
+        {
+            continue;
+        }
+
+        FNaughtySaveSnapshot Snapshot;
+        switch (FNaughtySaveArchive::Decode(SlotBytes, Snapshot, ENaughtySaveSections::Info))
+        {
+            case FNaughtySaveArchive::EDecodeResult::Success:
+                Slots.Add(FNaughtySaveSlotInfo::Make(Snapshot, SlotBytes.Num()));
+                bChanged = true;
+                break;
+
+            case FNaughtySaveArchive::EDecodeResult::Legacy:
+                if (const UNaughtySaveGame* LegacySave = Cast<UNaughtySaveGame>(UGameplayStatics::LoadGameFromMemory(SlotBytes)))
+                {
+                    Slots.Add(FNaughtySaveSlotInfo::Make(*LegacySave, SlotBytes.Num()));
+                    bChanged = true;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (bChanged)
+    {
+        Write();
+    }
+}
+
+void FNaughtySaveSlotIndex::Update(const FNaughtySaveSlotInfo& Info)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    const int32 Index = IndexOf(Info.SlotName, Info.SlotIndex);
+    if (Index == INDEX_NONE)
+    {
+        FNaughtySaveSlotInfo& Added = Slots.Add_GetRef(Info);
+        Added.SizeBytes = FMath::Max<int64>(Added.SizeBytes, 0);
+    }
+    else
+    {
+        const int64 PreviousSize = Slots[Index].SizeBytes;
+        Slots[Index] = Info;
+        if (Info.SizeBytes == INDEX_NONE)
+        {
+            Slots[Index].SizeBytes = PreviousSize;
+        }
+    }
+
+    Write();
+}
+
+void FNaughtySaveSlotIndex::Remove(const FString& SlotName, int32 SlotIndex)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    const int32 Index = IndexOf(SlotName, SlotIndex);
+    if (Index != INDEX_NONE)
+    {
+        Slots.RemoveAt(Index);
+        Write();
+    }
+}
+
+bool FNaughtySaveSlotIndex::Find(const FString& SlotName, int32 SlotIndex, FNaughtySaveSlotInfo& OutInfo) const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    const int32 Index = IndexOf(SlotName, SlotIndex);
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutInfo = Slots[Index];
+    return true;
+}
+
+TArray<FNaughtySaveSlotInfo> FNaughtySaveSlotIndex::GetSlots() const
+{
+    TArray<FNaughtySaveSlotInfo> Result;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Result = Slots;
+    }
+
+    Result.Sort([](const FNaughtySaveSlotInfo& A, const FNaughtySaveSlotInfo& B) { return A.SaveTime > B.SaveTime; });
+    return Result;
+}
+
+bool FNaughtySaveSlotIndex::Write() const
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+
+    uint32 Magic = FileMagic;
+    int32 Version = FormatVersion;
+    Writer << Magic;
+    Writer << Version;
+    Writer << const_cast<TArray<FNaughtySaveSlotInfo>&>(Slots);
+
+    // Write beside the index and rename over it, so a crash leaves either the old index or the new one
+    const FString IndexPath = GetIndexPath();
+    const FString TempPath = IndexPath + TEXT(".tmp");
+    if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*IndexPath, *TempPath, true, true))
+    {
+        UE_LOG(LogNaughtyShiba, Warning, TEXT("Failed to write save slot index %s"), *IndexPath);
+        return false;
+    }
+    return true;
+}
+
+int32 FNaughtySaveSlotIndex::IndexOf(const FString& SlotName, int32 SlotIndex) const
+{
+    return Slots.IndexOfByPredicate([&SlotName, SlotIndex](const FNaughtySaveSlotInfo& Info)
+    {
+        return Info.SlotIndex == SlotIndex && Info.SlotName == SlotName;
+    });
+}
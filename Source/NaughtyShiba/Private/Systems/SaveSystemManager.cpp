@@ -1,18 +1,32 @@
 #include "Systems/SaveSystemManager.h"
+#include "NaughtyShiba.h"
 #include "Systems/DebugConsole.h"
+#include "Systems/NaughtyProfiler.h"
+#include "Systems/NaughtySaveIdRegistry.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
+#include "Async/Async.h"
+#include "PlatformFeatures.h"
 
 void USaveSystemManager::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
+
+    // Name -> ID registry has to be in place before any save data is touched
+    IdRegistry = GetDefault<UNaughtySaveSettings>()->IdRegistry.LoadSynchronous();
+    UNaughtySaveIdRegistry::SetActive(IdRegistry);
     
     // Create default save data
     CurrentSaveData = NewObject<UNaughtySaveGame>(this);
     
     // Initialize debug console reference
     DebugConsole = nullptr;
+
+    // Load the platform save system here so worker-thread slot IO only ever looks it up
+    IPlatformFeaturesModule::Get().GetSaveGameSystem();
+
+    SlotMetadata->Load();
     
     UE_LOG(LogTemp, Warning, TEXT("=== Save System Manager Initialize Called ==="));
     UE_LOG(LogTemp, Warning, TEXT("Auto-save initially disabled (will be enabled by Game Instance)"));
@@ -22,9 +36,22 @@ void USaveSystemManager::Deinitialize()
 {
     // Disable auto-save
     DisableAutoSave();
+
+    // Let the worker finish, then write any saves still queued so nothing is lost on exit
+    WaitForInFlightRequest();
+    for (const FSaveRequest& Request : PendingRequests)
+    {
+        if (Request.bSave)
+        {
+            PerformSave(Request.SlotName, Request.SlotIndex);
+        }
+    }
+    PendingRequests.Empty();
     
     // Clear current save data
     CurrentSaveData = nullptr;
+
+    UNaughtySaveIdRegistry::ClearActive(IdRegistry);
     
     Super::Deinitialize();
     
@@ -38,9 +65,7 @@ void USaveSystemManager::SaveGame(const FString& SlotName, int32 SlotIndex)
 
 void USaveSystemManager::SaveGameAsync(const FString& SlotName, int32 SlotIndex)
 {
-    // For now, perform synchronous save
-    // Async implementation can be added later for larger save files
-    PerformSave(SlotName, SlotIndex);
+    QueueRequest(true, SlotName, SlotIndex);
 }
 
 void USaveSystemManager::QuickSave()
@@ -50,14 +75,12 @@ void USaveSystemManager::QuickSave()
 
 bool USaveSystemManager::LoadGame(const FString& SlotName, int32 SlotIndex)
 {
-    PerformLoad(SlotName, SlotIndex);
-    return CurrentSaveData != nullptr;
+    return PerformLoad(SlotName, SlotIndex);
 }
 
 void USaveSystemManager::LoadGameAsync(const FString& SlotName, int32 SlotIndex)
 {
-    // For now, perform synchronous load
-    PerformLoad(SlotName, SlotIndex);
+    QueueRequest(false, SlotName, SlotIndex);
 }
 
 void USaveSystemManager::QuickLoad()
@@ -72,7 +95,17 @@ bool USaveSystemManager::DoesSaveExist(const FString& SlotName, int32 SlotIndex)
 
 bool USaveSystemManager::DeleteSave(const FString& SlotName, int32 SlotIndex)
 {
+    WaitForInFlightRequest();
+    ++StateSerial;
+
     bool bSuccess = UGameplayStatics::DeleteGameInSlot(SlotName, SlotIndex);
+    FNaughtySaveJournal::DeleteFile(SlotName, SlotIndex);
+    SlotMetadata->Remove(SlotName, SlotIndex);
+
+    if (JournalSlotIndex == SlotIndex && JournalSlotName == SlotName)
+    {
+        BindJournal(FString(), 0, 0, 0);
+    }
     
     if (bSuccess)
     {
@@ -91,22 +124,9 @@ TArray<FString> USaveSystemManager::GetAllSaveSlots() const
 {
     TArray<FString> SaveSlots;
     
-    // Check for common save slot names
-    TArray<FString> CommonSlots = {
-        TEXT("DefaultSave"),
-        TEXT("QuickSave"),
-        TEXT("AutoSave"),
-        TEXT("Slot1"),
-        TEXT("Slot2"),
-        TEXT("Slot3")
-    };
-    
-    for (const FString& Slot : CommonSlots)
+    for (const FNaughtySaveSlotInfo& Info : SlotMetadata->GetSlots())
     {
-        if (DoesSaveExist(Slot, 0))
-        {
-            SaveSlots.Add(Slot);
-        }
+        SaveSlots.AddUnique(Info.SlotName);
     }
     
     return SaveSlots;
@@ -114,12 +134,64 @@ TArray<FString> USaveSystemManager::GetAllSaveSlots() const
 
 UNaughtySaveGame* USaveSystemManager::GetSaveGameInfo(const FString& SlotName, int32 SlotIndex) const
 {
-    if (UNaughtySaveGame* LoadedSave = Cast<UNaughtySaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, SlotIndex)))
+    // The slot index is locked, so it answers without waiting for an in-flight save
+    FNaughtySaveSlotInfo Info;
+    if (SlotMetadata->Find(SlotName, SlotIndex, Info))
     {
-        return LoadedSave;
+        UNaughtySaveGame* SaveInfo = NewObject<UNaughtySaveGame>(GetTransientPackage());
+        SaveInfo->SaveSlotName = Info.SlotName;
+        SaveInfo->SaveSlotIndex = Info.SlotIndex;
+        SaveInfo->SaveTime = Info.SaveTime;
+        SaveInfo->SaveVersion = Info.SaveVersion;
+        SaveInfo->PlayerProgress.TotalPlayTime = Info.PlayTimeHours * 3600.0f;
+        SaveInfo->WorldState.CurrentLevel = Info.CurrentLevel;
+        return SaveInfo;
     }
-    
-    return nullptr;
+
+    // Not indexed - read the file, which the worker may be halfway through rewriting
+    WaitForInFlightRequest();
+
+    TArray<uint8> Bytes;
+    if (!FNaughtySaveArchive::ReadSlot(SlotName, SlotIndex, Bytes))
+    {
+        return nullptr;
+    }
+
+    FNaughtySaveSnapshot Snapshot;
+    const FNaughtySaveArchive::EDecodeResult Result = FNaughtySaveArchive::Decode(Bytes, Snapshot, ENaughtySaveSections::Info);
+    if (Result == FNaughtySaveArchive::EDecodeResult::Success)
+    {
+        // Brings save and play time up to date; records for the sections that weren't decoded are dropped by Apply
+        FNaughtySaveJournal::Replay(SlotName, SlotIndex, FNaughtySaveJournal::GetGeneration(Snapshot), Snapshot);
+    }
+    return CreateLoadedSave(Result, Snapshot, Bytes);
+}
+
+bool USaveSystemManager::LoadSettings(const FString& SlotName, int32 SlotIndex, FGameSettings& OutSettings) const
+{
+    WaitForInFlightRequest();
+
+    TArray<uint8> Bytes;
+    if (!FNaughtySaveArchive::ReadSlot(SlotName, SlotIndex, Bytes))
+    {
+        return false;
+    }
+
+    FNaughtySaveSnapshot Snapshot;
+    const FNaughtySaveArchive::EDecodeResult Result = FNaughtySaveArchive::Decode(Bytes, Snapshot, ENaughtySaveSections::Settings);
+    if (Result == FNaughtySaveArchive::EDecodeResult::Success && !EnumHasAnyFlags(Snapshot.Sections, ENaughtySaveSections::Settings))
+    {
+        return false;
+    }
+
+    UNaughtySaveGame* LoadedSave = CreateLoadedSave(Result, Snapshot, Bytes);
+    if (!LoadedSave)
+    {
+        return false;
+    }
+
+    OutSettings = LoadedSave->GameSettings;
+    return true;
 }
 
 void USaveSystemManager::SetCurrentSaveData(UNaughtySaveGame* NewSaveData)
@@ -127,6 +199,10 @@ void USaveSystemManager::SetCurrentSaveData(UNaughtySaveGame* NewSaveData)
     if (NewSaveData)
     {
         CurrentSaveData = NewSaveData;
+        ++StateSerial;
+
+        // The journal no longer describes what's in memory
+        BindJournal(FString(), 0, 0, 0);
         
         if (DebugConsole)
         {
@@ -157,7 +233,11 @@ void USaveSystemManager::UnlockArea(const FString& AreaName)
 {
     if (UNaughtySaveGame* NaughtySave = Cast<UNaughtySaveGame>(CurrentSaveData))
     {
-        NaughtySave->PlayerProgress.UnlockedAreas.AddUnique(AreaName);
+        if (!NaughtySave->PlayerProgress.UnlockArea(AreaName))
+        {
+            return;
+        }
+        Journal.RecordUnlockArea(AreaName);
         
         if (DebugConsole)
         {
@@ -170,7 +250,11 @@ void USaveSystemManager::CompleteMission(const FString& MissionName)
 {
     if (UNaughtySaveGame* NaughtySave = Cast<UNaughtySaveGame>(CurrentSaveData))
     {
-        NaughtySave->PlayerProgress.CompletedMissions.AddUnique(MissionName);
+        if (!NaughtySave->PlayerProgress.CompleteMission(MissionName))
+        {
+            return;
+        }
+        Journal.RecordCompleteMission(MissionName);
         
         if (DebugConsole)
         {
@@ -184,6 +268,7 @@ void USaveSystemManager::AddTerritoryMarker(const FVector& Location)
     if (UNaughtySaveGame* NaughtySave = Cast<UNaughtySaveGame>(CurrentSaveData))
     {
         NaughtySave->WorldState.TerritoryMarkers.Add(Location);
+        Journal.RecordTerritoryMarker(Location);
     }
 }
 
@@ -200,6 +285,7 @@ void USaveSystemManager::UpdateNPCReputation(const FString& NPCName, int32 Reput
         {
             NaughtySave->WorldState.NPCReputation.Add(NPCName, ReputationChange);
         }
+        Journal.RecordNPCReputation(NPCName, ReputationChange);
     }
 }
 
@@ -207,10 +293,44 @@ void USaveSystemManager::SetWorldObjectState(const FString& ObjectName, bool bSt
 {
     if (UNaughtySaveGame* NaughtySave = Cast<UNaughtySaveGame>(CurrentSaveData))
     {
-        NaughtySave->WorldState.WorldObjects.Add(ObjectName, bState);
+        if (NaughtySave->WorldState.SetWorldObjectState(ObjectName, bState))
+        {
+            Journal.RecordWorldObjectState(ObjectName, bState);
+        }
     }
 }
 
+bool USaveSystemManager::IsAreaUnlocked(const FString& AreaName) const
+{
+    return CurrentSaveData && CurrentSaveData->PlayerProgress.IsAreaUnlocked(AreaName);
+}
+
+bool USaveSystemManager::IsMissionCompleted(const FString& MissionName) const
+{
+    return CurrentSaveData && CurrentSaveData->PlayerProgress.IsMissionCompleted(MissionName);
+}
+
+TArray<FString> USaveSystemManager::GetUnlockedAreas() const
+{
+    return CurrentSaveData ? CurrentSaveData->PlayerProgress.GetUnlockedAreas() : TArray<FString>();
+}
+
+TArray<FString> USaveSystemManager::GetCompletedMissions() const
+{
+    return CurrentSaveData ? CurrentSaveData->PlayerProgress.GetCompletedMissions() : TArray<FString>();
+}
+
+TMap<FString, bool> USaveSystemManager::GetWorldObjectStates() const
+{
+    return CurrentSaveData ? CurrentSaveData->WorldState.GetWorldObjectStates() : TMap<FString, bool>();
+}
+
+bool USaveSystemManager::GetWorldObjectState(const FString& ObjectName, bool& bOutState) const
+{
+    bOutState = false;
+    return CurrentSaveData && CurrentSaveData->WorldState.GetWorldObjectState(ObjectName, bOutState);
+}
+
 void USaveSystemManager::EnableAutoSave(float IntervalSeconds)
 {
     AutoSaveInterval = FMath::Max(IntervalSeconds, 60.0f); // Minimum 1 minute
@@ -244,50 +364,150 @@ void USaveSystemManager::DisableAutoSave()
     }
 }
 
-void USaveSystemManager::PerformSave(const FString& SlotName, int32 SlotIndex)
+void USaveSystemManager::CaptureForSave(const FString& SlotName, int32 SlotIndex, FNaughtySaveSnapshot& OutSnapshot)
 {
     if (!CurrentSaveData)
     {
         CurrentSaveData = NewObject<UNaughtySaveGame>(this);
     }
+
+    // Update save information
+    CurrentSaveData->SaveSlotName = SlotName;
+    CurrentSaveData->SaveSlotIndex = SlotIndex;
+    CurrentSaveData->UpdateSaveTime();
+    CurrentSaveData->ValidateData();
+    CurrentSaveData->ClearNeedsFullSave();
+
+    FNaughtySaveArchive::Capture(*CurrentSaveData, OutSnapshot);
+}
+
+void USaveSystemManager::BindJournal(const FString& SlotName, int32 SlotIndex, int64 Generation, int64 FileBytes)
+{
+    JournalSlotName = SlotName;
+    JournalSlotIndex = SlotIndex;
+    JournalGeneration = Generation;
+    JournalFileBytes = FileBytes;
+    JournalFlushes = 0;
+
+    // Anything recorded so far is part of the snapshot that was just saved or replaced
+    Journal.DiscardPendingRecords();
+    JournaledSettings = CurrentSaveData ? CurrentSaveData->GameSettings : FGameSettings();
+}
+
+void USaveSystemManager::BindLoadedJournal(const FString& SlotName, int32 SlotIndex, int64 BaseGeneration, int64 JournalBytes, bool bTornJournal)
+{
+    // Without a usable journal the next save has to be a full one, which also starts a clean journal
+    const bool bCanAppend = JournalBytes != INDEX_NONE && !bTornJournal;
+    BindJournal(SlotName, SlotIndex, bCanAppend ? BaseGeneration : 0, JournalBytes);
+}
+
+bool USaveSystemManager::CanAppendToJournal(const FString& SlotName, int32 SlotIndex) const
+{
+    return CurrentSaveData && !CurrentSaveData->NeedsFullSave() && JournalGeneration != 0 && JournalSlotIndex == SlotIndex && JournalSlotName == SlotName;
+}
+
+UNaughtySaveGame* USaveSystemManager::CreateLoadedSave(FNaughtySaveArchive::EDecodeResult Result, const FNaughtySaveSnapshot& Snapshot, const TArray<uint8>& Bytes) const
+{
+    UNaughtySaveGame* LoadedSave = nullptr;
+
+    switch (Result)
+    {
+        case FNaughtySaveArchive::EDecodeResult::Success:
+            LoadedSave = NewObject<UNaughtySaveGame>(GetTransientPackage());
+            FNaughtySaveArchive::Apply(Snapshot, *LoadedSave);
+            break;
+
+        case FNaughtySaveArchive::EDecodeResult::Legacy:
+            // Saves from before the async format; rewritten in the new format on the next save
+            LoadedSave = Cast<UNaughtySaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes));
+            break;
+
+        default:
+            break;
+    }
+
+    if (LoadedSave)
+    {
+        // Partial loads keep the version they were written with so it can be shown as-is
+        const bool bFullSave = Result == FNaughtySaveArchive::EDecodeResult::Legacy || Snapshot.Sections == ENaughtySaveSections::All;
+        if (bFullSave && LoadedSave->NeedsMigration())
+        {
+            LoadedSave->MigrateFromOldVersion(LoadedSave->SaveVersion);
+        }
+        LoadedSave->ValidateData();
+    }
+    return LoadedSave;
+}
+
+void USaveSystemManager::PerformSave(const FString& SlotName, int32 SlotIndex)
+{
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_SavePerform, Save);
+
+    // Never write the slot files underneath the worker
+    WaitForInFlightRequest();
+    ++StateSerial;
+
+    FNaughtySaveSnapshot Snapshot;
+    CaptureForSave(SlotName, SlotIndex, Snapshot);
+
+    TArray<uint8> Bytes;
+    const bool bSuccess = FNaughtySaveArchive::Encode(Snapshot, Bytes) && FNaughtySaveArchive::WriteSlot(SlotName, SlotIndex, Bytes);
+    if (bSuccess)
+    {
+        SlotMetadata->Update(FNaughtySaveSlotInfo::Make(Snapshot, Bytes.Num()));
+    }
+
+    // A full save starts the slot's journal over
+    const int64 Generation = FNaughtySaveJournal::GetGeneration(Snapshot);
+    const bool bJournalReset = bSuccess && FNaughtySaveJournal::ResetFile(SlotName, SlotIndex, Generation);
+    BindJournal(SlotName, SlotIndex, bJournalReset ? Generation : 0, FNaughtySaveJournal::HeaderSize);
     
-    // Cast to our save game type
-    if (UNaughtySaveGame* NaughtySave = Cast<UNaughtySaveGame>(CurrentSaveData))
+    if (bSuccess)
     {
-        // Update save information
-        NaughtySave->SaveSlotName = SlotName;
-        NaughtySave->SaveSlotIndex = SlotIndex;
-        NaughtySave->UpdateSaveTime();
-        NaughtySave->ValidateData();
-        
-        // Perform the save
-        bool bSuccess = UGameplayStatics::SaveGameToSlot(NaughtySave, SlotName, SlotIndex);
-        
-        if (bSuccess)
+        if (DebugConsole)
         {
-            if (DebugConsole)
-            {
-                DebugConsole->LogInfo(FString::Printf(TEXT("Game saved successfully: %s [%d]"), *SlotName, SlotIndex));
-            }
+            DebugConsole->LogInfo(FString::Printf(TEXT("Game saved successfully: %s [%d]"), *SlotName, SlotIndex));
         }
-        else
+    }
+    else
+    {
+        if (DebugConsole)
         {
-            if (DebugConsole)
-            {
-                DebugConsole->LogError(FString::Printf(TEXT("Failed to save game: %s [%d]"), *SlotName, SlotIndex));
-            }
+            DebugConsole->LogError(FString::Printf(TEXT("Failed to save game: %s [%d]"), *SlotName, SlotIndex));
         }
-        
-        OnSaveComplete.Broadcast(bSuccess);
     }
+    
+    OnSaveComplete.Broadcast(bSuccess);
 }
 
-void USaveSystemManager::PerformLoad(const FString& SlotName, int32 SlotIndex)
+bool USaveSystemManager::PerformLoad(const FString& SlotName, int32 SlotIndex)
 {
-    if (UNaughtySaveGame* LoadedSave = Cast<UNaughtySaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, SlotIndex)))
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_LoadPerform, Save);
+
+    WaitForInFlightRequest();
+    ++StateSerial;
+
+    TArray<uint8> Bytes;
+    FNaughtySaveSnapshot Snapshot;
+    FNaughtySaveArchive::EDecodeResult Result = FNaughtySaveArchive::EDecodeResult::Corrupt;
+    if (FNaughtySaveArchive::ReadSlot(SlotName, SlotIndex, Bytes))
+    {
+        Result = FNaughtySaveArchive::Decode(Bytes, Snapshot);
+    }
+
+    int64 BaseGeneration = 0;
+    int64 JournalBytes = INDEX_NONE;
+    bool bTornJournal = false;
+    if (Result == FNaughtySaveArchive::EDecodeResult::Success)
+    {
+        BaseGeneration = FNaughtySaveJournal::GetGeneration(Snapshot);
+        JournalBytes = FNaughtySaveJournal::Replay(SlotName, SlotIndex, BaseGeneration, Snapshot, &bTornJournal);
+    }
+
+    if (UNaughtySaveGame* LoadedSave = CreateLoadedSave(Result, Snapshot, Bytes))
     {
-        LoadedSave->ValidateData();
         CurrentSaveData = LoadedSave;
+        BindLoadedJournal(SlotName, SlotIndex, BaseGeneration, JournalBytes, bTornJournal);
         
         if (DebugConsole)
         {
@@ -295,15 +515,275 @@ void USaveSystemManager::PerformLoad(const FString& SlotName, int32 SlotIndex)
         }
         
         OnLoadComplete.Broadcast(true);
+        return true;
+    }
+
+    if (DebugConsole)
+    {
+        DebugConsole->LogError(FString::Printf(TEXT("Failed to load game: %s [%d]"), *SlotName, SlotIndex));
+    }
+    
+    OnLoadComplete.Broadcast(false);
+    return false;
+}
+
+void USaveSystemManager::QueueRequest(bool bSave, const FString& SlotName, int32 SlotIndex)
+{
+    // A matching request that hasn't started yet snapshots when it starts, so it already covers this one
+    const bool bAlreadyQueued = PendingRequests.ContainsByPredicate([bSave, &SlotName, SlotIndex](const FSaveRequest& Request)
+    {
+        return Request.bSave == bSave && Request.SlotIndex == SlotIndex && Request.SlotName == SlotName;
+    });
+
+    if (!bAlreadyQueued)
+    {
+        PendingRequests.Add({ bSave, SlotName, SlotIndex });
+    }
+
+    if (!bRequestInFlight)
+    {
+        StartNextRequest();
+    }
+}
+
+void USaveSystemManager::StartNextRequest()
+{
+    if (PendingRequests.Num() == 0)
+    {
+        return;
+    }
+
+    const FSaveRequest Request = PendingRequests[0];
+    PendingRequests.RemoveAt(0);
+    bRequestInFlight = true;
+
+    TWeakObjectPtr<USaveSystemManager> WeakThis(this);
+    const uint32 Serial = StateSerial;
+
+    if (Request.bSave && CanAppendToJournal(Request.SlotName, Request.SlotIndex))
+    {
+        // Same slot as the last full save or load: only the changes since then go to disk
+        TSharedRef<TArray<uint8>> Records = MakeShared<TArray<uint8>>();
+        {
+            NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_SaveSnapshot, Save);
+            CurrentSaveData->UpdateSaveTime();
+
+            // Same clamping a full save gets; anything it changes is in the records below
+            CurrentSaveData->ValidateData();
+
+            // Values without a mutation call of their own are recorded once per flush rather than per change
+            const FPlayerProgressData& Progress = CurrentSaveData->PlayerProgress;
+            Journal.RecordPlayerProgress(Progress.CourageLevel, Progress.TotalBarks, Progress.TerritoriesMarked);
+            Journal.RecordPlayTime(Progress.TotalPlayTime);
+            Journal.RecordSessionState(Progress.MaxCourage, Progress.LastSaveLocation, CurrentSaveData->WorldState.CurrentLevel);
+            Journal.RecordSaveTime(CurrentSaveData->SaveTime);
+
+            // Settings rarely change and are the largest record, so only when they differ from the journaled copy
+            if (!FGameSettings::StaticStruct()->CompareScriptStruct(&JournaledSettings, &CurrentSaveData->GameSettings, PPF_None))
+            {
+                Journal.RecordGameSettings(CurrentSaveData->GameSettings);
+                JournaledSettings = CurrentSaveData->GameSettings;
+            }
+
+            *Records = Journal.TakePendingRecords();
+        }
+
+        const int64 Generation = JournalGeneration;
+        const int64 FileBytes = JournalFileBytes + sizeof(int32) + Records->Num();
+
+        // Size alone could leave a slowly growing journal uncompacted for the whole session
+        const bool bCompact = FileBytes > JournalCompactionBytes || ++JournalFlushes >= JournalCompactionFlushes;
+
+        // The snapshot isn't rewritten, so the indexed size stays unless compaction replaces it
+        FNaughtySaveSlotInfo SlotInfo = FNaughtySaveSlotInfo::Make(*CurrentSaveData, INDEX_NONE);
+        TSharedRef<FNaughtySaveSlotIndex, ESPMode::ThreadSafe> Metadata = SlotMetadata;
+
+        InFlightTask = Async(EAsyncExecution::ThreadPool, [WeakThis, Serial, Request, Records, Generation, FileBytes, bCompact, SlotInfo, Metadata]() mutable
+        {
+            NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_SaveJournal, Save);
+
+            const bool bSuccess = FNaughtySaveJournal::AppendBlock(Request.SlotName, Request.SlotIndex, *Records);
+            int64 NewGeneration = bSuccess ? Generation : 0;
+            int64 NewFileBytes = FileBytes;
+
+            if (bSuccess && bCompact)
+            {
+                NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_SaveCompact, Save);
+
+                const int64 CompactedGeneration = FNaughtySaveJournal::Compact(Request.SlotName, Request.SlotIndex, Generation, &SlotInfo.SizeBytes);
+                if (CompactedGeneration != 0)
+                {
+                    NewGeneration = FMath::Max<int64>(CompactedGeneration, 0);
+                    NewFileBytes = FNaughtySaveJournal::HeaderSize;
+                }
+            }
+
+            if (bSuccess)
+            {
+                Metadata->Update(SlotInfo);
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Request, bSuccess, Generation, NewGeneration, NewFileBytes]()
+            {
+                if (USaveSystemManager* SaveManager = WeakThis.Get())
+                {
+                    SaveManager->FinishSave(Serial, Request.SlotName, Request.SlotIndex, bSuccess, Generation, NewGeneration, NewFileBytes);
+                }
+            });
+        });
+    }
+    else if (Request.bSave)
+    {
+        // The only game thread work: copying the save data out
+        TSharedRef<FNaughtySaveSnapshot> Snapshot = MakeShared<FNaughtySaveSnapshot>();
+        {
+            NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_SaveSnapshot, Save);
+            CaptureForSave(Request.SlotName, Request.SlotIndex, *Snapshot);
+        }
+
+        // Changes made while this is in flight are journaled against the new snapshot
+        const int64 Generation = FNaughtySaveJournal::GetGeneration(*Snapshot);
+        BindJournal(Request.SlotName, Request.SlotIndex, Generation, FNaughtySaveJournal::HeaderSize);
+
+        TSharedRef<FNaughtySaveSlotIndex, ESPMode::ThreadSafe> Metadata = SlotMetadata;
+
+        InFlightTask = Async(EAsyncExecution::ThreadPool, [WeakThis, Serial, Request, Snapshot, Generation, Metadata]()
+        {
+            NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_SaveWorker, Save);
+
+            TArray<uint8> Bytes;
+            const bool bSuccess = FNaughtySaveArchive::Encode(*Snapshot, Bytes) && FNaughtySaveArchive::WriteSlot(Request.SlotName, Request.SlotIndex, Bytes);
+            if (bSuccess)
+            {
+                Metadata->Update(FNaughtySaveSlotInfo::Make(*Snapshot, Bytes.Num()));
+            }
+            const bool bJournalReset = bSuccess && FNaughtySaveJournal::ResetFile(Request.SlotName, Request.SlotIndex, Generation);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Request, bSuccess, Generation, bJournalReset]()
+            {
+                if (USaveSystemManager* SaveManager = WeakThis.Get())
+                {
+                    SaveManager->FinishSave(Serial, Request.SlotName, Request.SlotIndex, bSuccess, Generation, bJournalReset ? Generation : 0, FNaughtySaveJournal::HeaderSize);
+                }
+            });
+        });
     }
     else
     {
-        if (DebugConsole)
+        InFlightTask = Async(EAsyncExecution::ThreadPool, [WeakThis, Serial, Request]()
         {
-            DebugConsole->LogError(FString::Printf(TEXT("Failed to load game: %s [%d]"), *SlotName, SlotIndex));
+            NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_LoadWorker, Save);
+
+            TSharedRef<TArray<uint8>> Bytes = MakeShared<TArray<uint8>>();
+            TSharedRef<FNaughtySaveSnapshot> Snapshot = MakeShared<FNaughtySaveSnapshot>();
+            FNaughtySaveArchive::EDecodeResult Result = FNaughtySaveArchive::EDecodeResult::Corrupt;
+            if (FNaughtySaveArchive::ReadSlot(Request.SlotName, Request.SlotIndex, *Bytes))
+            {
+                Result = FNaughtySaveArchive::Decode(*Bytes, *Snapshot);
+            }
+
+            int64 BaseGeneration = 0;
+            int64 JournalBytes = INDEX_NONE;
+            bool bTornJournal = false;
+            if (Result == FNaughtySaveArchive::EDecodeResult::Success)
+            {
+                BaseGeneration = FNaughtySaveJournal::GetGeneration(*Snapshot);
+                JournalBytes = FNaughtySaveJournal::Replay(Request.SlotName, Request.SlotIndex, BaseGeneration, *Snapshot, &bTornJournal);
+            }
+
+            // Decoded saves no longer need the raw bytes; only legacy ones are parsed on the game thread
+            if (Result != FNaughtySaveArchive::EDecodeResult::Legacy)
+            {
+                Bytes->Empty();
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Request, Result, Snapshot, Bytes, BaseGeneration, JournalBytes, bTornJournal]()
+            {
+                if (USaveSystemManager* SaveManager = WeakThis.Get())
+                {
+                    SaveManager->FinishLoad(Serial, Request.SlotName, Request.SlotIndex, Result, *Snapshot, *Bytes, BaseGeneration, JournalBytes, bTornJournal);
+                }
+            });
+        });
+    }
+}
+
+void USaveSystemManager::FinishSave(uint32 RequestSerial, const FString& SlotName, int32 SlotIndex, bool bSuccess, int64 ExpectedGeneration, int64 NewGeneration, int64 NewJournalBytes)
+{
+    bRequestInFlight = false;
+
+    // The file was written either way, but a sync operation since then owns the journal binding now
+    if (RequestSerial == StateSerial && JournalGeneration == ExpectedGeneration && JournalSlotIndex == SlotIndex && JournalSlotName == SlotName)
+    {
+        // A new generation means the journal was compacted (or a full save reset it) and starts counting again
+        if (NewGeneration != ExpectedGeneration)
+        {
+            JournalFlushes = 0;
         }
-        
+
+        JournalGeneration = NewGeneration;
+        JournalFileBytes = NewJournalBytes;
+    }
+
+    if (DebugConsole)
+    {
+        if (bSuccess)
+        {
+            DebugConsole->LogInfo(FString::Printf(TEXT("Game saved successfully: %s [%d]"), *SlotName, SlotIndex));
+        }
+        else
+        {
+            DebugConsole->LogError(FString::Printf(TEXT("Failed to save game: %s [%d]"), *SlotName, SlotIndex));
+        }
+    }
+
+    OnSaveComplete.Broadcast(bSuccess);
+    StartNextRequest();
+}
+
+void USaveSystemManager::FinishLoad(uint32 RequestSerial, const FString& SlotName, int32 SlotIndex, FNaughtySaveArchive::EDecodeResult Result, const FNaughtySaveSnapshot& Snapshot, const TArray<uint8>& Bytes, int64 BaseGeneration, int64 JournalBytes, bool bTornJournal)
+{
+    bRequestInFlight = false;
+
+    // A sync save, load, delete or SetCurrentSaveData since the read started wins over what the worker read
+    if (RequestSerial != StateSerial)
+    {
+        UE_LOG(LogNaughtyShiba, Warning, TEXT("Discarding async load of %s [%d]; the save data changed while it was loading"), *SlotName, SlotIndex);
+
         OnLoadComplete.Broadcast(false);
+        StartNextRequest();
+        return;
+    }
+
+    UNaughtySaveGame* LoadedSave = CreateLoadedSave(Result, Snapshot, Bytes);
+    if (LoadedSave)
+    {
+        CurrentSaveData = LoadedSave;
+        BindLoadedJournal(SlotName, SlotIndex, BaseGeneration, JournalBytes, bTornJournal);
+    }
+
+    if (DebugConsole)
+    {
+        if (LoadedSave)
+        {
+            DebugConsole->LogInfo(FString::Printf(TEXT("Game loaded successfully: %s [%d]"), *SlotName, SlotIndex));
+        }
+        else
+        {
+            DebugConsole->LogError(FString::Printf(TEXT("Failed to load game: %s [%d]"), *SlotName, SlotIndex));
+        }
+    }
+
+    OnLoadComplete.Broadcast(LoadedSave != nullptr);
+    StartNextRequest();
+}
+
+void USaveSystemManager::WaitForInFlightRequest() const
+{
+    if (InFlightTask.IsValid())
+    {
+        InFlightTask.Wait();
+        InFlightTask.Reset();
     }
 }
 
@@ -311,6 +791,6 @@ void USaveSystemManager::AutoSaveTimer()
 {
     if (bAutoSaveEnabled)
     {
-        SaveGame(TEXT("AutoSave"), 0);
+        SaveGameAsync(TEXT("AutoSave"), 0);
     }
 }
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "Systems/ShibaActionScheduler.h"
+#include "Characters/ShibaCharacter.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "EngineUtils.h"
+#include "WorldTime.h"  // GMCv2 WorldTimeReplicator
+
+void UShibaActionScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Entries.Reserve(64);
+    PendingIndex.Reserve(64);
+}
+
+void UShibaActionScheduler::Deinitialize()
+{
+    // Pending actions die with the world; owners are being torn down as well
+    for (TArray<int32>& Bucket : Buckets)
+    {
+        Bucket.Empty();
+    }
+    Entries.Empty();
+    FreeEntries.Empty();
+    PendingIndex.Empty();
+    TimeReplicator.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UShibaActionScheduler::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UShibaActionScheduler::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShibaActionScheduler, STATGROUP_Tickables);
+}
+
+UShibaActionScheduler* UShibaActionScheduler::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UShibaActionScheduler>() : nullptr;
+}
+
+double UShibaActionScheduler::GetTimeSeconds() const
+{
+    if (const AGMC_WorldTimeReplicator* Replicator = TimeReplicator.Get())
+    {
+        return Replicator->GetRealWorldTimeSecondsReplicated();
+    }
+
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UShibaActionScheduler::FindTimeReplicator()
+{
+    UWorld* World = GetWorld();
+    if (!World || TimeReplicator.IsValid() || World->GetTimeSeconds() < NextReplicatorSearchTime)
+    {
+        return;
+    }
+
+    // Replicator may spawn after the first actions are scheduled; retry once a second until found
+    NextReplicatorSearchTime = World->GetTimeSeconds() + 1.0;
+    for (TActorIterator<AGMC_WorldTimeReplicator> It(World); It; ++It)
+    {
+        TimeReplicator = *It;
+        break;
+    }
+}
+
+uint64 UShibaActionScheduler::MakeKey(const AShibaCharacter* Owner, EShibaActionSlot Slot)
+{
+    return (static_cast<uint64>(Owner->GetUniqueID()) << 8) | static_cast<uint64>(Slot);
+}
+
+int32 UShibaActionScheduler::AllocateEntry()
+{
+    if (FreeEntries.Num() > 0)
+    {
+        return FreeEntries.Pop(false);
+    }
+    return Entries.AddDefaulted();
+}
+
+void UShibaActionScheduler::RemoveEntry(int32 EntryIndex)
+{
+    FScheduledAction& Entry = Entries[EntryIndex];
+
+    Buckets[Entry.Bucket].RemoveSingleSwap(EntryIndex, false);
+    PendingIndex.Remove(Entry.Key);
+
+    Entry = FScheduledAction();
+    FreeEntries.Add(EntryIndex);
+}
+
+void UShibaActionScheduler::Schedule(AShibaCharacter* Owner, EShibaActionSlot Slot, float Duration)
+{
+    if (!Owner || Slot == EShibaActionSlot::Count)
+    {
+        return;
+    }
+
+    FindTimeReplicator();
+    AddEntry(Owner, Slot, GetTimeSeconds() + FMath::Max(Duration, 0.0f));
+}
+
+void UShibaActionScheduler::ScheduleFromMove(AShibaCharacter* Owner, EShibaActionSlot Slot, float Duration, double MoveTime, bool bReplaying)
+{
+    if (!Owner || Slot == EShibaActionSlot::Count)
+    {
+        return;
+    }
+
+    // Re-scheduling on replay would push the expiry past the one the server computed for the same move
+    if (bReplaying && PendingIndex.Contains(MakeKey(Owner, Slot)))
+    {
+        return;
+    }
+
+    FindTimeReplicator();
+
+    // Move timestamps are on the GMC-synchronized clock; only anchor to them when the wheel runs on that clock too,
+    // otherwise (local world time fallback) the two time bases differ and the action would fire early or late
+    const double StartTime = TimeReplicator.IsValid() ? MoveTime : GetTimeSeconds();
+    AddEntry(Owner, Slot, StartTime + FMath::Max(Duration, 0.0f));
+}
+
+void UShibaActionScheduler::AddEntry(AShibaCharacter* Owner, EShibaActionSlot Slot, double ExpireTime)
+{
+    if (!bWheelStarted)
+    {
+        LastProcessedTick = TimeToTick(GetTimeSeconds()) - 1;
+        bWheelStarted = true;
+    }
+
+    // Replace whatever is pending in this slot
+    const uint64 Key = MakeKey(Owner, Slot);
+    if (const int32* Existing = PendingIndex.Find(Key))
+    {
+        RemoveEntry(*Existing);
+    }
+
+    // Never drop an entry into a bucket the wheel has already passed
+    const int64 ExpireTick = FMath::Max(TimeToTick(ExpireTime), LastProcessedTick + 1);
+
+    const int32 EntryIndex = AllocateEntry();
+    FScheduledAction& Entry = Entries[EntryIndex];
+    Entry.Owner = Owner;
+    Entry.ExpireTime = ExpireTime;
+    Entry.Key = Key;
+    Entry.Bucket = static_cast<int32>(ExpireTick % NumBuckets);
+    Entry.Slot = Slot;
+
+    Buckets[Entry.Bucket].Add(EntryIndex);
+    PendingIndex.Add(Key, EntryIndex);
+}
+
+bool UShibaActionScheduler::Cancel(const AShibaCharacter* Owner, EShibaActionSlot Slot)
+{
+    if (!Owner)
+    {
+        return false;
+    }
+
+    if (const int32* Existing = PendingIndex.Find(MakeKey(Owner, Slot)))
+    {
+        RemoveEntry(*Existing);
+        return true;
+    }
+    return false;
+}
+
+void UShibaActionScheduler::CancelAll(const AShibaCharacter* Owner)
+{
+    for (uint8 Slot = 0; Slot < static_cast<uint8>(EShibaActionSlot::Count); ++Slot)
+    {
+        Cancel(Owner, static_cast<EShibaActionSlot>(Slot));
+    }
+}
+
+bool UShibaActionScheduler::IsPending(const AShibaCharacter* Owner, EShibaActionSlot Slot) const
+{
+    return Owner && PendingIndex.Contains(MakeKey(Owner, Slot));
+}
+
+void UShibaActionScheduler::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (PendingIndex.Num() == 0)
+    {
+        return;
+    }
+
+    FindTimeReplicator();
+
+    const double Now = GetTimeSeconds();
+    const int64 CurrentTick = TimeToTick(Now);
+    if (CurrentTick <= LastProcessedTick)
+    {
+        return; // Replicated clock stepped backwards; wait for it to catch up
+    }
+
+    // Walk every bucket passed since last frame (at most one revolution), including the current one
+    const int64 TicksToScan = FMath::Min<int64>(CurrentTick - LastProcessedTick, NumBuckets);
+    ExpiredScratch.Reset();
+
+    for (int64 WheelTick = CurrentTick - TicksToScan + 1; WheelTick <= CurrentTick; ++WheelTick)
+    {
+        TArray<int32>& Bucket = Buckets[WheelTick % NumBuckets];
+        for (int32 i = Bucket.Num() - 1; i >= 0; --i)
+        {
+            const int32 EntryIndex = Bucket[i];
+            const FScheduledAction& Entry = Entries[EntryIndex];
+            if (Entry.ExpireTime <= Now)
+            {
+                ExpiredScratch.Emplace(Entry.Owner, Entry.Slot);
+                RemoveEntry(EntryIndex);
+            }
+        }
+    }
+
+    // The current bucket may still hold entries due later this tick, so it is scanned again next frame
+    LastProcessedTick = CurrentTick - 1;
+
+    // Dispatch after the wheel is consistent; handlers are free to schedule again
+    for (const TPair<TWeakObjectPtr<AShibaCharacter>, EShibaActionSlot>& Expired : ExpiredScratch)
+    {
+        if (AShibaCharacter* Owner = Expired.Key.Get())
+        {
+            Owner->OnScheduledActionExpired(Expired.Value);
+        }
+    }
+}
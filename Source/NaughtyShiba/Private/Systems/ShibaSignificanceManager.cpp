@@ -0,0 +1,193 @@
+#include "Systems/ShibaSignificanceManager.h"
+#include "Characters/ShibaCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+namespace ShibaSignificance
+{
+    // Indexed by EShibaSignificanceTier
+    static const FShibaSignificanceTierSettings TierSettings[] =
+    {
+        // MaxDistance  Actor     Mesh      Movement  Cosmetics
+        { 0.0f,         0.0f,     0.0f,     0.0f,     true  },  // Local
+        { 2000.0f,      0.0f,     0.0f,     0.0f,     true  },  // Near  (< 20m)
+        { 5000.0f,      1/30.f,   0.0f,     1/30.f,   true  },  // Mid   (< 50m)
+        { 0.0f,         0.1f,     0.0f,     0.05f,    false },  // Far   (mesh rate handled by URO)
+        { 0.0f,         0.25f,    0.25f,    0.05f,    false },  // Culled
+    };
+
+    // A pawn only drops to a cheaper tier once it is this far past the boundary, to stop tier flapping
+    static constexpr float DemoteHysteresis = 1.1f;
+
+    // Seconds without rendering before a pawn counts as off-screen
+    static constexpr float RecentlyRenderedTolerance = 0.5f;
+
+    static EShibaSignificanceTier TierForDistance(float DistanceSquared, float Scale)
+    {
+        if (DistanceSquared <= FMath::Square(TierSettings[(int32)EShibaSignificanceTier::Near].MaxDistance * Scale))
+        {
+            return EShibaSignificanceTier::Near;
+        }
+        if (DistanceSquared <= FMath::Square(TierSettings[(int32)EShibaSignificanceTier::Mid].MaxDistance * Scale))
+        {
+            return EShibaSignificanceTier::Mid;
+        }
+        return EShibaSignificanceTier::Far;
+    }
+}
+
+bool UShibaSignificanceManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+    if (!Super::ShouldCreateSubsystem(Outer))
+    {
+        return false;
+    }
+
+    // Dedicated servers have no viewer and must simulate every dog at full rate
+    return !IsRunningDedicatedServer();
+}
+
+bool UShibaSignificanceManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UShibaSignificanceManager::Deinitialize()
+{
+    Characters.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UShibaSignificanceManager::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShibaSignificanceManager, STATGROUP_Tickables);
+}
+
+UShibaSignificanceManager* UShibaSignificanceManager::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UShibaSignificanceManager>() : nullptr;
+}
+
+const FShibaSignificanceTierSettings& UShibaSignificanceManager::GetTierSettings(EShibaSignificanceTier Tier)
+{
+    return ShibaSignificance::TierSettings[FMath::Min<int32>((int32)Tier, UE_ARRAY_COUNT(ShibaSignificance::TierSettings) - 1)];
+}
+
+bool UShibaSignificanceManager::ShouldRunTierUpdate(float Interval, float TimeSeconds, float& NextUpdateTime)
+{
+    if (Interval <= 0.0f)
+    {
+        NextUpdateTime = TimeSeconds;
+        return true;
+    }
+
+    if (TimeSeconds < NextUpdateTime)
+    {
+        return false;
+    }
+
+    // Step from the due time so the average rate holds; resync after a stall or a tier change instead of bursting
+    NextUpdateTime = (TimeSeconds - NextUpdateTime < Interval) ? NextUpdateTime + Interval : TimeSeconds + Interval;
+    return true;
+}
+
+void UShibaSignificanceManager::RegisterCharacter(AShibaCharacter* Character)
+{
+    if (Character)
+    {
+        Characters.AddUnique(Character);
+
+        // Score new arrivals on the next tick instead of waiting out the interval
+        TimeUntilEvaluation = 0.0f;
+    }
+}
+
+void UShibaSignificanceManager::UnregisterCharacter(AShibaCharacter* Character)
+{
+    Characters.RemoveSingleSwap(Character, false);
+}
+
+int32 UShibaSignificanceManager::GetNumInTier(EShibaSignificanceTier Tier) const
+{
+    int32 Count = 0;
+    for (const TWeakObjectPtr<AShibaCharacter>& Character : Characters)
+    {
+        if (Character.IsValid() && Character->GetSignificanceTier() == Tier)
+        {
+            ++Count;
+        }
+    }
+    return Count;
+}
+
+void UShibaSignificanceManager::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    TimeUntilEvaluation -= DeltaTime;
+    if (TimeUntilEvaluation > 0.0f || Characters.Num() == 0)
+    {
+        return;
+    }
+
+    TimeUntilEvaluation = EvaluationInterval;
+    EvaluateSignificance();
+}
+
+void UShibaSignificanceManager::EvaluateSignificance()
+{
+    UWorld* World = GetWorld();
+    APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+    if (!PC || !PC->IsLocalController())
+    {
+        return;
+    }
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+    for (int32 i = Characters.Num() - 1; i >= 0; --i)
+    {
+        AShibaCharacter* Character = Characters[i].Get();
+        if (!Character)
+        {
+            Characters.RemoveAtSwap(i, 1, false);
+            continue;
+        }
+
+        Character->SetSignificanceTier(ScoreCharacter(Character, ViewLocation));
+    }
+}
+
+EShibaSignificanceTier UShibaSignificanceManager::ScoreCharacter(const AShibaCharacter* Character, const FVector& ViewLocation) const
+{
+    using namespace ShibaSignificance;
+
+    if (Character->IsLocallyControlled())
+    {
+        return EShibaSignificanceTier::Local;
+    }
+
+    const float DistanceSquared = FVector::DistSquared(ViewLocation, Character->GetActorLocation());
+    const EShibaSignificanceTier CurrentTier = Character->GetSignificanceTier();
+
+    EShibaSignificanceTier NewTier = TierForDistance(DistanceSquared, 1.0f);
+    if (NewTier > CurrentTier && CurrentTier != EShibaSignificanceTier::Culled)
+    {
+        // Demoting - require the pawn to clear the boundary by the hysteresis margin
+        NewTier = FMath::Max(CurrentTier, TierForDistance(DistanceSquared, DemoteHysteresis));
+    }
+
+    // Off-screen dogs beyond the near ring drop to the cheapest tier
+    if (NewTier != EShibaSignificanceTier::Near && !Character->WasRecentlyRendered(RecentlyRenderedTolerance))
+    {
+        NewTier = EShibaSignificanceTier::Culled;
+    }
+
+    return NewTier;
+}
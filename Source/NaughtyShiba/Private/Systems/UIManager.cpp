@@ -1,5 +1,6 @@
 #include "Systems/UIManager.h"
 #include "Systems/DebugConsole.h"
+#include "Systems/NaughtyProfiler.h"
 #include "UI/BaseWidget.h"
 #include "Engine/World.h"
 #include "Engine/GameViewportClient.h"
@@ -7,6 +8,15 @@
 #include "Kismet/GameplayStatics.h"  // Add this for UGameplayStatics
 #include "Blueprint/WidgetBlueprintLibrary.h"  // Add this for widget creation
 
+bool UUIManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // No UI on servers - compiled out of server builds, skipped at runtime for -server editor sessions
+#if UE_SERVER
+    return false;
+#else
+    return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+#endif
+}
 
 void UUIManager::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -44,6 +54,11 @@ void UUIManager::Deinitialize()
 
 UBaseWidget* UUIManager::CreateWidget(TSubclassOf<UBaseWidget> WidgetClass, EUILayer Layer)
 {
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_UICreateWidget, UI);
+
+#if UE_SERVER
+    return nullptr;
+#else
     if (!WidgetClass)
     {
         if (DebugConsole)
@@ -105,10 +120,13 @@ UBaseWidget* UUIManager::CreateWidget(TSubclassOf<UBaseWidget> WidgetClass, EUIL
         DebugConsole->LogError(FString::Printf(TEXT("Failed to create widget: %s"), *WidgetClass->GetName()));
     }
     return nullptr;
+#endif
 }
 
 bool UUIManager::AddWidget(UBaseWidget* Widget, EUILayer Layer)
 {
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_UIAddWidget, UI);
+
     if (!Widget)
     {
         return false;
@@ -145,6 +163,8 @@ bool UUIManager::AddWidget(UBaseWidget* Widget, EUILayer Layer)
 
 bool UUIManager::RemoveWidget(UBaseWidget* Widget)
 {
+    NAUGHTY_PROFILE_SCOPE_CATEGORY(Naughty_UIRemoveWidget, UI);
+
     if (!Widget)
     {
         return false;
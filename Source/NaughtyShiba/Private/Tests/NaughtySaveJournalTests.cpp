@@ -0,0 +1,85 @@
+#include "Misc/AutomationTest.h"
+#include "Systems/NaughtySaveJournal.h"
+#include "HAL/FileManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NaughtySaveJournalTests
+{
+    static const TCHAR* SlotName = TEXT("AutomationTest_Journal");
+    static constexpr int32 SlotIndex = 0;
+    static constexpr int64 Generation = 1234;
+
+    static bool AppendUnlock(FNaughtySaveJournal& Journal, const FString& AreaName)
+    {
+        Journal.RecordUnlockArea(AreaName);
+        return FNaughtySaveJournal::AppendBlock(SlotName, SlotIndex, Journal.TakePendingRecords());
+    }
+
+    // What a crash in the middle of AppendBlock leaves behind: a length prefix promising more bytes than follow
+    static bool AppendTornBlock()
+    {
+        TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*FNaughtySaveJournal::GetJournalPath(SlotName, SlotIndex), FILEWRITE_Append));
+        if (!File)
+        {
+            return false;
+        }
+
+        int32 BlockSize = 64;
+        uint8 Partial[3] = { 0, 1, 2 };
+        *File << BlockSize;
+        File->Serialize(Partial, sizeof(Partial));
+        return File->Close();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNaughtySaveJournalTornTailTest, "NaughtyShiba.SaveSystem.Journal.TornTail",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FNaughtySaveJournalTornTailTest::RunTest(const FString& Parameters)
+{
+    using namespace NaughtySaveJournalTests;
+
+    FNaughtySaveJournal Journal;
+    TestTrue(TEXT("Journal started"), FNaughtySaveJournal::ResetFile(SlotName, SlotIndex, Generation));
+    TestTrue(TEXT("First block appended"), AppendUnlock(Journal, TEXT("Park")));
+    TestTrue(TEXT("Torn block written"), AppendTornBlock());
+
+    // Load after the crash: the complete block replays, the torn tail is reported and excluded from the size
+    FNaughtySaveSnapshot Loaded;
+    bool bTornTail = false;
+    const int64 ValidBytes = FNaughtySaveJournal::Replay(SlotName, SlotIndex, Generation, Loaded, &bTornTail);
+    TestTrue(TEXT("Torn tail detected"), bTornTail);
+    FNaughtySaveJournal Probe;
+    Probe.RecordUnlockArea(TEXT("Park"));
+    const int64 FirstBlockBytes = sizeof(int32) + Probe.TakePendingRecords().Num();
+    TestEqual(TEXT("Size ends at the last complete block"), ValidBytes, FNaughtySaveJournal::HeaderSize + FirstBlockBytes);
+    TestTrue(TEXT("Block before the tear applied"), Loaded.PlayerProgress.IsAreaUnlocked(TEXT("Park")));
+
+    // Appending behind the tear would be lost: the torn length prefix swallows the new block
+    TestTrue(TEXT("Block appended after the tear"), AppendUnlock(Journal, TEXT("Beach")));
+    FNaughtySaveSnapshot Swallowed;
+    FNaughtySaveJournal::Replay(SlotName, SlotIndex, Generation, Swallowed);
+    TestFalse(TEXT("Block behind a torn tail is unreadable"), Swallowed.PlayerProgress.IsAreaUnlocked(TEXT("Beach")));
+
+    // What the save manager does instead: a torn journal forces a full save, which starts a clean journal
+    const int64 NewGeneration = Generation + 1;
+    TestTrue(TEXT("Journal restarted by the full save"), FNaughtySaveJournal::ResetFile(SlotName, SlotIndex, NewGeneration));
+    TestTrue(TEXT("Block appended to the new journal"), AppendUnlock(Journal, TEXT("Beach")));
+
+    FNaughtySaveSnapshot Reloaded;
+    bTornTail = true;
+    const int64 ReloadedBytes = FNaughtySaveJournal::Replay(SlotName, SlotIndex, NewGeneration, Reloaded, &bTornTail);
+    TestFalse(TEXT("Restarted journal is clean"), bTornTail);
+    TestEqual(TEXT("Restarted journal replays to its end"), ReloadedBytes, IFileManager::Get().FileSize(*FNaughtySaveJournal::GetJournalPath(SlotName, SlotIndex)));
+    TestTrue(TEXT("Block appended after the reset applied"), Reloaded.PlayerProgress.IsAreaUnlocked(TEXT("Beach")));
+
+    // The old generation's journal is gone for good
+    FNaughtySaveSnapshot Stale;
+    TestEqual(TEXT("Old generation no longer replays"), FNaughtySaveJournal::Replay(SlotName, SlotIndex, Generation, Stale), (int64)INDEX_NONE);
+
+    FNaughtySaveJournal::DeleteFile(SlotName, SlotIndex);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,49 @@
+#include "Misc/AutomationTest.h"
+#include "Systems/ShibaSignificanceManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ShibaSignificanceTests
+{
+    // Runs a tier's rate limiter over two seconds of 60 fps frames and counts the updates it lets through
+    static int32 CountUpdates(EShibaSignificanceTier Tier)
+    {
+        const float Interval = UShibaSignificanceManager::GetTierSettings(Tier).ActorTickInterval;
+        float NextUpdateTime = 0.0f;
+        int32 Updates = 0;
+
+        for (int32 Frame = 0; Frame < 120; ++Frame)
+        {
+            if (UShibaSignificanceManager::ShouldRunTierUpdate(Interval, Frame / 60.0f, NextUpdateTime))
+            {
+                ++Updates;
+            }
+        }
+        return Updates;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShibaSignificanceLogicRateTest, "NaughtyShiba.Significance.LogicRate",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShibaSignificanceLogicRateTest::RunTest(const FString& Parameters)
+{
+    using namespace ShibaSignificanceTests;
+
+    const int32 Near = CountUpdates(EShibaSignificanceTier::Near);
+    const int32 Mid = CountUpdates(EShibaSignificanceTier::Mid);
+    const int32 Far = CountUpdates(EShibaSignificanceTier::Far);
+    const int32 Culled = CountUpdates(EShibaSignificanceTier::Culled);
+
+    TestEqual(TEXT("Near dogs update every frame"), Near, 120);
+    TestTrue(TEXT("Mid dogs update less often than near ones"), Mid < Near);
+    TestTrue(TEXT("Far dogs update less often than mid ones"), Far < Mid);
+    TestTrue(TEXT("Culled dogs update least"), Culled < Far);
+
+    // 10 Hz over two seconds, give or take the first frame
+    TestTrue(TEXT("Far dogs hold their tier rate"), Far >= 19 && Far <= 21);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,81 @@
+#include "Tools/ShibaBotSubsystem.h"
+#include "NaughtyShiba.h"
+#include "Characters/ShibaCharacter.h"
+#include "Core/NaughtyPlayerController.h"
+#include "Movement/ShibaGMCMovement.h"
+#include "Engine/World.h"
+#include "Misc/CommandLine.h"
+
+bool UShibaBotSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    // Bots are clients; a dedicated server has no local pawn to drive
+    return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer() && FParse::Param(FCommandLine::Get(), TEXT("ShibaBot"));
+}
+
+bool UShibaBotSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UShibaBotSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Distinct seeds per process unless the launcher hands one out
+    Seed = FPlatformProcess::GetCurrentProcessId();
+    FParse::Value(FCommandLine::Get(), TEXT("BotSeed="), Seed);
+
+    FString PatternName;
+    if (FParse::Value(FCommandLine::Get(), TEXT("BotPattern="), PatternName) && !FShibaInputScript::ParsePattern(PatternName, Pattern))
+    {
+        UE_LOG(LogNaughtyShiba, Warning, TEXT("ShibaBot: unknown pattern '%s', using abilities"), *PatternName);
+        Pattern = EShibaInputPattern::Abilities;
+    }
+
+    UE_LOG(LogNaughtyShiba, Display, TEXT("ShibaBot: enabled (pattern %s, seed %d)"), FShibaInputScript::GetPatternName(Pattern), Seed);
+}
+
+void UShibaBotSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+    AShibaCharacter* Character = PlayerController ? Cast<AShibaCharacter>(PlayerController->GetPawn()) : nullptr;
+    if (!Character || !Character->IsLocallyControlled())
+    {
+        return;
+    }
+
+    // New pawn (first possession or respawn) - restart the script from the same seed
+    if (ControlledCharacter.Get() != Character)
+    {
+        ControlledCharacter = Character;
+        Script.Initialize(Pattern, Seed);
+    }
+
+    Script.Step(Character, DeltaTime);
+
+    TimeUntilReport -= DeltaTime;
+    if (TimeUntilReport <= 0.0f)
+    {
+        TimeUntilReport = ReportInterval;
+        ReportStats(Character);
+    }
+}
+
+void UShibaBotSubsystem::ReportStats(AShibaCharacter* Character)
+{
+    ANaughtyPlayerController* PlayerController = Cast<ANaughtyPlayerController>(Character->GetController());
+    UShibaGMCMovement* Movement = Character->GetGMCMovementComponent();
+    if (!PlayerController || !Movement)
+    {
+        return;
+    }
+
+    PlayerController->ServerReportMovementStats(Movement->GetNumClientReplays(), Movement->GetNumClientMoves());
+}
+
+TStatId UShibaBotSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShibaBotSubsystem, STATGROUP_Tickables);
+}
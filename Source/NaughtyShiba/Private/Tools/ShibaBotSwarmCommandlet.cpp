@@ -0,0 +1,142 @@
+#include "Tools/ShibaBotSwarmCommandlet.h"
+#include "NaughtyShiba.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformProcess.h"
+
+namespace ShibaBotSwarm
+{
+    static FProcHandle Launch(const FString& Args)
+    {
+        // Same binary as this commandlet; the editor build needs the project file and -game/-server to run a session
+        const FString Executable = FPlatformProcess::ExecutablePath();
+        const FString FullArgs = FString::Printf(TEXT("\"%s\" %s"), *FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()), *Args);
+
+        UE_LOG(LogNaughtyShiba, Display, TEXT("ShibaBotSwarm: launching %s %s"), *Executable, *FullArgs);
+        return FPlatformProcess::CreateProc(*Executable, *FullArgs, true, true, true, nullptr, 0, nullptr, nullptr);
+    }
+
+    // Sleep in short steps so a dead server ends the run instead of ramping bots at nothing
+    static bool Wait(float Seconds, FProcHandle& Server)
+    {
+        const double EndTime = FPlatformTime::Seconds() + Seconds;
+        while (FPlatformTime::Seconds() < EndTime)
+        {
+            if (Server.IsValid() && !FPlatformProcess::IsProcRunning(Server))
+            {
+                UE_LOG(LogNaughtyShiba, Error, TEXT("ShibaBotSwarm: server exited early"));
+                return false;
+            }
+            FPlatformProcess::Sleep(0.25f);
+        }
+        return true;
+    }
+
+    static void Stop(FProcHandle& Handle)
+    {
+        if (Handle.IsValid())
+        {
+            if (FPlatformProcess::IsProcRunning(Handle))
+            {
+                FPlatformProcess::TerminateProc(Handle, true);
+            }
+            FPlatformProcess::CloseProc(Handle);
+        }
+    }
+}
+
+UShibaBotSwarmCommandlet::UShibaBotSwarmCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+
+    HelpDescription = TEXT("Starts a local dedicated server and ramps up headless Shiba bot clients against it");
+    HelpUsage = TEXT("-run=ShibaBotSwarm [-Bots=] [-RampInterval=] [-Hold=] [-Map=] [-Port=] [-BotPattern=] [-NoServer] [-ServerAddress=]");
+}
+
+int32 UShibaBotSwarmCommandlet::Main(const FString& Params)
+{
+    using namespace ShibaBotSwarm;
+
+    // Options
+    FString MapName = TEXT("/Game/Maps/GMC_TestLevel");
+    FString ServerAddress = TEXT("127.0.0.1");
+    FString BotPattern = TEXT("abilities");
+    int32 NumBots = 16;
+    int32 Port = 7777;
+    float RampInterval = 15.0f;
+    float HoldTime = 60.0f;
+    float ServerStartupTime = 20.0f;
+
+    FParse::Value(*Params, TEXT("Map="), MapName);
+    FParse::Value(*Params, TEXT("ServerAddress="), ServerAddress);
+    FParse::Value(*Params, TEXT("BotPattern="), BotPattern);
+    FParse::Value(*Params, TEXT("Bots="), NumBots);
+    FParse::Value(*Params, TEXT("Port="), Port);
+    FParse::Value(*Params, TEXT("RampInterval="), RampInterval);
+    FParse::Value(*Params, TEXT("Hold="), HoldTime);
+    FParse::Value(*Params, TEXT("ServerStartup="), ServerStartupTime);
+    const bool bLaunchServer = !FParse::Param(*Params, TEXT("NoServer"));
+
+    NumBots = FMath::Clamp(NumBots, 1, 256);
+
+    const FString Timestamp = FDateTime::Now().ToString();
+
+    FProcHandle Server;
+    if (bLaunchServer)
+    {
+        const FString CsvPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("LoadTest") / FString::Printf(TEXT("ShibaLoad_%s.csv"), *Timestamp));
+        Server = Launch(FString::Printf(TEXT("%s -server -nullrhi -nosound -unattended -Port=%d -ShibaLoadReport -ShibaLoadCsv=\"%s\" -log=ShibaLoadServer_%s.log"),
+            *MapName, Port, *CsvPath, *Timestamp));
+
+        if (!Server.IsValid())
+        {
+            UE_LOG(LogNaughtyShiba, Error, TEXT("ShibaBotSwarm: failed to launch server"));
+            return 1;
+        }
+
+        UE_LOG(LogNaughtyShiba, Display, TEXT("ShibaBotSwarm: server report will be written to %s"), *CsvPath);
+        if (!Wait(ServerStartupTime, Server))
+        {
+            Stop(Server);
+            return 1;
+        }
+    }
+
+    // Ramp: one more bot every RampInterval so each step of the CSV has a stable bot count
+    TArray<FProcHandle> Bots;
+    bool bServerAlive = true;
+    for (int32 Index = 0; Index < NumBots && bServerAlive; ++Index)
+    {
+        FProcHandle Bot = Launch(FString::Printf(TEXT("%s:%d -game -nullrhi -nosound -unattended -ShibaBot -BotSeed=%d -BotPattern=%s -log=ShibaBot_%s_%02d.log"),
+            *ServerAddress, Port, Index + 1, *BotPattern, *Timestamp, Index));
+
+        if (Bot.IsValid())
+        {
+            Bots.Add(Bot);
+            UE_LOG(LogNaughtyShiba, Display, TEXT("ShibaBotSwarm: %d/%d bots running"), Bots.Num(), NumBots);
+        }
+        else
+        {
+            UE_LOG(LogNaughtyShiba, Warning, TEXT("ShibaBotSwarm: failed to launch bot %d"), Index);
+        }
+
+        bServerAlive = Wait(RampInterval, Server);
+    }
+
+    if (bServerAlive)
+    {
+        UE_LOG(LogNaughtyShiba, Display, TEXT("ShibaBotSwarm: holding %d bots for %.0fs"), Bots.Num(), HoldTime);
+        bServerAlive = Wait(HoldTime, Server);
+    }
+
+    for (FProcHandle& Bot : Bots)
+    {
+        Stop(Bot);
+    }
+    Stop(Server);
+
+    UE_LOG(LogNaughtyShiba, Display, TEXT("ShibaBotSwarm: done"));
+    return bServerAlive ? 0 : 1;
+}
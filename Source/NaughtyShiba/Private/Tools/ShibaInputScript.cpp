@@ -0,0 +1,180 @@
+#include "Tools/ShibaInputScript.h"
+#include "Characters/ShibaCharacter.h"
+#include "Components/InputManagerComponent.h"
+#include "Movement/ShibaGMCMovement.h"
+
+namespace ShibaInputScript
+{
+    static const TCHAR* PatternNames[] =
+    {
+        TEXT("wander"),
+        TEXT("sprint"),
+        TEXT("jump"),
+        TEXT("crouch"),
+        TEXT("mixed"),
+        TEXT("abilities")
+    };
+
+    // Abilities the Abilities pattern picks from
+    static const EShibaInputAction BotAbilities[] =
+    {
+        EShibaInputAction::Bark,
+        EShibaInputAction::Howl,
+        EShibaInputAction::SniffVision,
+        EShibaInputAction::MarkTerritory,
+        EShibaInputAction::Defecate,
+        EShibaInputAction::PickUp
+    };
+    static_assert(UE_ARRAY_COUNT(PatternNames) == (int32)EShibaInputPattern::Count, "PatternNames out of sync with EShibaInputPattern");
+}
+
+bool FShibaInputScript::ParsePattern(const FString& Name, EShibaInputPattern& OutPattern)
+{
+    for (int32 Index = 0; Index < (int32)EShibaInputPattern::Count; ++Index)
+    {
+        if (Name.Equals(ShibaInputScript::PatternNames[Index], ESearchCase::IgnoreCase))
+        {
+            OutPattern = static_cast<EShibaInputPattern>(Index);
+            return true;
+        }
+    }
+    return false;
+}
+
+const TCHAR* FShibaInputScript::GetPatternName(EShibaInputPattern Pattern)
+{
+    return Pattern < EShibaInputPattern::Count ? ShibaInputScript::PatternNames[(int32)Pattern] : TEXT("unknown");
+}
+
+void FShibaInputScript::Initialize(EShibaInputPattern InPattern, int32 Seed)
+{
+    Pattern = InPattern;
+    ActivePattern = InPattern;
+    Stream.Initialize(Seed);
+
+    MoveInput = FVector2D::ZeroVector;
+    TimeUntilDecision = 0.0f;
+    TimeUntilAction = Stream.FRandRange(0.0f, 0.5f);
+    PendingReleases.Reset();
+    bSprintHeld = false;
+    bCrouchHeld = false;
+    NumActionsIssued = 0;
+}
+
+void FShibaInputScript::Decide()
+{
+    if (Pattern == EShibaInputPattern::Mixed)
+    {
+        ActivePattern = static_cast<EShibaInputPattern>(Stream.RandRange(0, (int32)EShibaInputPattern::Mixed - 1));
+    }
+
+    // Wandering dogs sometimes just stand around; the other patterns always move
+    const bool bStandStill = ActivePattern == EShibaInputPattern::Wander && Stream.FRand() < 0.2f;
+    if (bStandStill)
+    {
+        MoveInput = FVector2D::ZeroVector;
+    }
+    else
+    {
+        const float Angle = Stream.FRandRange(0.0f, 2.0f * PI);
+        MoveInput = FVector2D(FMath::Sin(Angle), FMath::Cos(Angle));
+    }
+
+    TimeUntilDecision = Stream.FRandRange(2.0f, 4.0f);
+}
+
+void FShibaInputScript::Press(UInputManagerComponent* InputManager, EShibaInputAction Action)
+{
+    InputManager->InjectAction(Action, true);
+    ++NumActionsIssued;
+}
+
+void FShibaInputScript::Release(UInputManagerComponent* InputManager, EShibaInputAction Action)
+{
+    InputManager->InjectAction(Action, false);
+}
+
+void FShibaInputScript::Step(AShibaCharacter* Character, float DeltaTime)
+{
+    if (!Character)
+    {
+        return;
+    }
+
+    UInputManagerComponent* InputManager = Character->FindComponentByClass<UInputManagerComponent>();
+
+    TimeUntilDecision -= DeltaTime;
+    if (TimeUntilDecision <= 0.0f)
+    {
+        Decide();
+    }
+
+    if (!InputManager)
+    {
+        // Native pawn without the Blueprint input component - movement only, straight into GMC
+        if (UShibaGMCMovement* Movement = Character->GetGMCMovementComponent())
+        {
+            Movement->AddInputVector(FVector(MoveInput.Y, MoveInput.X, 0.0f));
+        }
+        return;
+    }
+
+    // Button taps from last step
+    for (EShibaInputAction Action : PendingReleases)
+    {
+        Release(InputManager, Action);
+    }
+    PendingReleases.Reset();
+
+    // Movement is re-sent every frame, like a held stick
+    InputManager->InjectMoveInput(MoveInput);
+
+    // Held buttons follow the active pattern
+    const bool bWantSprint = ActivePattern == EShibaInputPattern::Sprint;
+    if (bWantSprint != bSprintHeld)
+    {
+        bWantSprint ? Press(InputManager, EShibaInputAction::Sprint) : Release(InputManager, EShibaInputAction::Sprint);
+        bSprintHeld = bWantSprint;
+    }
+
+    if (ActivePattern != EShibaInputPattern::CrouchToggle && bCrouchHeld)
+    {
+        Release(InputManager, EShibaInputAction::Crouch);
+        bCrouchHeld = false;
+    }
+
+    TimeUntilAction -= DeltaTime;
+    if (TimeUntilAction > 0.0f)
+    {
+        return;
+    }
+
+    switch (ActivePattern)
+    {
+        case EShibaInputPattern::JumpSpam:
+            Press(InputManager, EShibaInputAction::Jump);
+            PendingReleases.Add(EShibaInputAction::Jump);
+            TimeUntilAction = Stream.FRandRange(0.4f, 0.6f);
+            break;
+
+        case EShibaInputPattern::CrouchToggle:
+            bCrouchHeld ? Release(InputManager, EShibaInputAction::Crouch) : Press(InputManager, EShibaInputAction::Crouch);
+            bCrouchHeld = !bCrouchHeld;
+            TimeUntilAction = 1.0f;
+            break;
+
+        case EShibaInputPattern::Abilities:
+        {
+            // Press-only actions ignore the release, so every ability can be treated as a tap
+            const EShibaInputAction Ability = ShibaInputScript::BotAbilities[Stream.RandRange(0, UE_ARRAY_COUNT(ShibaInputScript::BotAbilities) - 1)];
+            Press(InputManager, Ability);
+            PendingReleases.Add(Ability);
+            TimeUntilAction = Stream.FRandRange(1.0f, 3.0f);
+            break;
+        }
+
+        default:
+            TimeUntilAction = 0.5f;
+            break;
+    }
+}
@@ -0,0 +1,139 @@
+#include "Tools/ShibaLoadTestMonitor.h"
+#include "NaughtyShiba.h"
+#include "Core/NaughtyPlayerController.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+bool UShibaLoadTestMonitor::ShouldCreateSubsystem(UObject* Outer) const
+{
+    return Super::ShouldCreateSubsystem(Outer) && FParse::Param(FCommandLine::Get(), TEXT("ShibaLoadReport"));
+}
+
+bool UShibaLoadTestMonitor::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UShibaLoadTestMonitor::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    FParse::Value(FCommandLine::Get(), TEXT("ShibaLoadInterval="), ReportInterval);
+    ReportInterval = FMath::Max(ReportInterval, 1.0f);
+    TimeUntilReport = ReportInterval;
+
+    if (!FParse::Value(FCommandLine::Get(), TEXT("ShibaLoadCsv="), CsvPath))
+    {
+        CsvPath = FPaths::ProjectSavedDir() / TEXT("LoadTest") / FString::Printf(TEXT("ShibaLoad_%s.csv"), *FDateTime::Now().ToString());
+    }
+}
+
+void UShibaLoadTestMonitor::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Only servers have connections to report on
+    const ENetMode NetMode = GetWorld()->GetNetMode();
+    if (NetMode != NM_DedicatedServer && NetMode != NM_ListenServer)
+    {
+        return;
+    }
+
+    // Frame delta includes the sleep that caps the server tick rate; the busy part is what bots cost us
+    const double BusyMs = FMath::Max(DeltaTime - FApp::GetIdleTime(), 0.0) * 1000.0;
+    TickTimeSumMs += BusyMs;
+    TickTimeMaxMs = FMath::Max(TickTimeMaxMs, BusyMs);
+    ++NumTicks;
+
+    ElapsedSeconds += DeltaTime;
+    TimeUntilReport -= DeltaTime;
+    if (TimeUntilReport <= 0.0f)
+    {
+        WriteReport();
+        TimeUntilReport = ReportInterval;
+        TickTimeSumMs = 0.0;
+        TickTimeMaxMs = 0.0;
+        NumTicks = 0;
+    }
+}
+
+void UShibaLoadTestMonitor::WriteReport()
+{
+    UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+    const TArray<UNetConnection*> NoConnections;
+    const TArray<UNetConnection*>& Connections = NetDriver ? NetDriver->ClientConnections : NoConnections;
+
+    int64 TotalOutBytes = 0;
+    int64 TotalInBytes = 0;
+    int32 MaxOutBytes = 0;
+    double TotalPingMs = 0.0;
+    int32 IntervalReplays = 0;
+    int32 IntervalMoves = 0;
+
+    for (UNetConnection* Connection : Connections)
+    {
+        if (!Connection)
+        {
+            continue;
+        }
+
+        TotalOutBytes += Connection->OutBytesPerSecond;
+        TotalInBytes += Connection->InBytesPerSecond;
+        MaxOutBytes = FMath::Max(MaxOutBytes, Connection->OutBytesPerSecond);
+        TotalPingMs += Connection->AvgLag * 1000.0;
+
+        // Clients report cumulative counters; the difference is this interval's corrections
+        if (const ANaughtyPlayerController* PlayerController = Cast<ANaughtyPlayerController>(Connection->PlayerController))
+        {
+            FConnectionSnapshot& Snapshot = Snapshots.FindOrAdd(Connection);
+            IntervalReplays += FMath::Max(PlayerController->GetReportedReplays() - Snapshot.Replays, 0);
+            IntervalMoves += FMath::Max(PlayerController->GetReportedMoves() - Snapshot.Moves, 0);
+            Snapshot.Replays = PlayerController->GetReportedReplays();
+            Snapshot.Moves = PlayerController->GetReportedMoves();
+        }
+    }
+
+    // Drop connections that went away
+    for (auto It = Snapshots.CreateIterator(); It; ++It)
+    {
+        if (!It->Key.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    const int32 NumConnections = Connections.Num();
+    const double Divisor = FMath::Max(NumConnections, 1);
+    const double TickAvgMs = NumTicks > 0 ? TickTimeSumMs / NumTicks : 0.0;
+    const double CorrectionsPerSecond = IntervalReplays / ReportInterval / Divisor;
+    const double CorrectionPercent = IntervalMoves > 0 ? 100.0 * IntervalReplays / IntervalMoves : 0.0;
+
+    UE_LOG(LogNaughtyShiba, Display,
+        TEXT("[ShibaLoad] t=%.0fs conns=%d tick avg %.2f ms max %.2f ms | out %.1f KB/s per conn (max %.1f) in %.1f KB/s | ping %.0f ms | corrections %.2f/s per conn (%.2f%% of moves)"),
+        ElapsedSeconds, NumConnections, TickAvgMs, TickTimeMaxMs,
+        TotalOutBytes / Divisor / 1024.0, MaxOutBytes / 1024.0, TotalInBytes / Divisor / 1024.0,
+        TotalPingMs / Divisor, CorrectionsPerSecond, CorrectionPercent);
+
+    FString Row;
+    if (!FPaths::FileExists(CsvPath))
+    {
+        Row = TEXT("time_s,connections,tick_avg_ms,tick_max_ms,out_bytes_per_conn,out_bytes_max_conn,in_bytes_per_conn,ping_avg_ms,corrections_per_sec_per_conn,correction_pct\n");
+    }
+
+    Row += FString::Printf(TEXT("%.1f,%d,%.3f,%.3f,%.0f,%d,%.0f,%.1f,%.3f,%.3f\n"),
+        ElapsedSeconds, NumConnections, TickAvgMs, TickTimeMaxMs,
+        TotalOutBytes / Divisor, MaxOutBytes, TotalInBytes / Divisor,
+        TotalPingMs / Divisor, CorrectionsPerSecond, CorrectionPercent);
+
+    FFileHelper::SaveStringToFile(Row, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+TStatId UShibaLoadTestMonitor::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UShibaLoadTestMonitor, STATGROUP_Tickables);
+}
@@ -0,0 +1,439 @@
+#include "Tools/ShibaMovementBenchmarkCommandlet.h"
+#include "Tools/ShibaInputScript.h"
+#include "NaughtyShiba.h"
+#include "Characters/ShibaCharacter.h"
+#include "Movement/ShibaGMCMovement.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerStart.h"
+#include "GameFramework/WorldSettings.h"
+#include "EngineUtils.h"
+#include "Tickable.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include <atomic>
+
+namespace ShibaBenchmark
+{
+    /**
+     * Counts the installing thread's allocator traffic while installed as GMalloc; everything is forwarded to the real allocator
+     * Worker threads (task graph, audio, async loading) allocate through it too but are not counted
+     * Never deleted - another thread may still be inside it after it is uninstalled
+     */
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+        explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+        {
+            if (IsCountingThread())
+            {
+                NumAllocs.fetch_add(1, std::memory_order_relaxed);
+            }
+            return Inner->Malloc(Count, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            if (IsCountingThread())
+            {
+                NumReallocs.fetch_add(1, std::memory_order_relaxed);
+            }
+            return Inner->Realloc(Original, Count, Alignment);
+        }
+
+        virtual void Free(void* Original) override
+        {
+            if (Original && IsCountingThread())
+            {
+                NumFrees.fetch_add(1, std::memory_order_relaxed);
+            }
+            Inner->Free(Original);
+        }
+
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+        virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+        virtual void UpdateStats() override { Inner->UpdateStats(); }
+        virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+        virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+        virtual const TCHAR* GetDescriptiveName() override { return TEXT("ShibaCountingMalloc"); }
+
+        // Only the calling thread is counted until the next Install
+        void Install()
+        {
+            Reset();
+            CountingThreadId.store(FPlatformTLS::GetCurrentThreadId(), std::memory_order_relaxed);
+            GMalloc = this;
+        }
+
+        void Uninstall()
+        {
+            GMalloc = Inner;
+        }
+
+        void Reset()
+        {
+            NumAllocs = 0;
+            NumReallocs = 0;
+            NumFrees = 0;
+        }
+
+        bool IsCountingThread() const
+        {
+            return FPlatformTLS::GetCurrentThreadId() == CountingThreadId.load(std::memory_order_relaxed);
+        }
+
+        FMalloc* Inner;
+        std::atomic<uint32> CountingThreadId{0};
+        std::atomic<uint64> NumAllocs{0};
+        std::atomic<uint64> NumReallocs{0};
+        std::atomic<uint64> NumFrees{0};
+    };
+
+    struct FFrameStats
+    {
+        double MeanMs = 0.0;
+        double P50Ms = 0.0;
+        double P95Ms = 0.0;
+        double MaxMs = 0.0;
+    };
+
+    static FFrameStats Summarize(TArray<double> FrameTimes)
+    {
+        FFrameStats Stats;
+        if (FrameTimes.Num() == 0)
+        {
+            return Stats;
+        }
+
+        FrameTimes.Sort();
+        double Total = 0.0;
+        for (double Time : FrameTimes)
+        {
+            Total += Time;
+        }
+
+        Stats.MeanMs = Total / FrameTimes.Num();
+        Stats.P50Ms = FrameTimes[FrameTimes.Num() / 2];
+        Stats.P95Ms = FrameTimes[FMath::Min(FrameTimes.Num() - 1, FMath::FloorToInt(FrameTimes.Num() * 0.95))];
+        Stats.MaxMs = FrameTimes.Last();
+        return Stats;
+    }
+
+    static TSharedRef<FJsonObject> StatsToJson(const FFrameStats& Stats)
+    {
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetNumberField(TEXT("mean_ms"), Stats.MeanMs);
+        Object->SetNumberField(TEXT("p50_ms"), Stats.P50Ms);
+        Object->SetNumberField(TEXT("p95_ms"), Stats.P95Ms);
+        Object->SetNumberField(TEXT("max_ms"), Stats.MaxMs);
+        return Object;
+    }
+
+    // One engine frame for a world we own; returns the frame's cost in ms
+    static double TickWorld(UWorld* World, float DeltaTime)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        FApp::SetDeltaTime(DeltaTime);
+        FApp::SetCurrentTime(FApp::GetCurrentTime() + DeltaTime);
+
+        World->Tick(LEVELTICK_All, DeltaTime);
+
+        // World subsystems (scheduler, significance) tick through the tickable object list, not the world
+        FTickableGameObject::TickObjects(World, LEVELTICK_All, false, DeltaTime);
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+        ++GFrameCounter;
+        return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    }
+
+    static UWorld* LoadWorld(const FString& MapName)
+    {
+        UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+        UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+        if (!World)
+        {
+            return nullptr;
+        }
+
+        World->WorldType = EWorldType::Game;
+        World->AddToRoot();
+
+        FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+        Context.SetCurrentWorld(World);
+
+        if (!World->bIsWorldInitialized)
+        {
+            World->InitWorld(UWorld::InitializationValues()
+                .AllowAudioPlayback(false)
+                .CreatePhysicsScene(true)
+                .ShouldSimulatePhysics(true));
+        }
+
+        World->UpdateWorldComponents(true, false);
+
+        // No game mode - start play directly so the benchmark only measures the pawns we spawn
+        FURL URL;
+        World->InitializeActorsForPlay(URL);
+        World->GetWorldSettings()->NotifyBeginPlay();
+        World->GetWorldSettings()->NotifyMatchStarted();
+
+        return World;
+    }
+
+    static void DestroyWorld(UWorld* World)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+        World->RemoveFromRoot();
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+}
+
+UShibaMovementBenchmarkCommandlet::UShibaMovementBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = true;
+    IsEditor = false;
+    LogToConsole = true;
+
+    HelpDescription = TEXT("Spawns N Shiba pawns with scripted input and reports UShibaGMCMovement cost as JSON");
+    HelpUsage = TEXT("-run=ShibaMovementBenchmark -nullrhi [-Map=] [-Pawns=] [-Frames=] [-Warmup=] [-Pattern=] [-PawnClass=] [-Seed=] [-Output=]");
+}
+
+int32 UShibaMovementBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace ShibaBenchmark;
+
+    // Options
+    FString MapName = TEXT("/Game/Maps/GMC_TestLevel");
+    FString PawnClassPath = TEXT("/Game/Blueprints/Characters/BP_ShibaCharacter.BP_ShibaCharacter_C");
+    FString PatternName = TEXT("mixed");
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("ShibaMovement_%s.json"), *FDateTime::Now().ToString());
+    int32 NumPawns = 32;
+    int32 NumFrames = 600;
+    int32 NumWarmupFrames = 60;
+    int32 NumBaselineFrames = 120;
+    int32 Seed = 1;
+    float DeltaTime = 1.0f / 60.0f;
+
+    FParse::Value(*Params, TEXT("Map="), MapName);
+    FParse::Value(*Params, TEXT("PawnClass="), PawnClassPath);
+    FParse::Value(*Params, TEXT("Pattern="), PatternName);
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+    FParse::Value(*Params, TEXT("Pawns="), NumPawns);
+    FParse::Value(*Params, TEXT("Frames="), NumFrames);
+    FParse::Value(*Params, TEXT("Warmup="), NumWarmupFrames);
+    FParse::Value(*Params, TEXT("Baseline="), NumBaselineFrames);
+    FParse::Value(*Params, TEXT("Seed="), Seed);
+    FParse::Value(*Params, TEXT("DeltaTime="), DeltaTime);
+
+    NumPawns = FMath::Clamp(NumPawns, 1, 1024);
+    NumFrames = FMath::Max(NumFrames, 1);
+    DeltaTime = FMath::Clamp(DeltaTime, 0.001f, 0.1f);
+
+    EShibaInputPattern Pattern;
+    if (!FShibaInputScript::ParsePattern(PatternName, Pattern))
+    {
+        UE_LOG(LogNaughtyShiba, Error, TEXT("Unknown pattern '%s' (wander|sprint|jump|crouch|mixed|abilities)"), *PatternName);
+        return 1;
+    }
+
+    UClass* PawnClass = LoadClass<AShibaCharacter>(nullptr, *PawnClassPath);
+    if (!PawnClass)
+    {
+        UE_LOG(LogNaughtyShiba, Warning, TEXT("Pawn class '%s' not found - using native AShibaCharacter (no input component, movement only)"), *PawnClassPath);
+        PawnClass = AShibaCharacter::StaticClass();
+    }
+
+    UWorld* World = LoadWorld(MapName);
+    if (!World)
+    {
+        UE_LOG(LogNaughtyShiba, Error, TEXT("Failed to load map '%s'"), *MapName);
+        return 1;
+    }
+
+    UE_LOG(LogNaughtyShiba, Display, TEXT("Shiba benchmark: %d pawns, %d frames, pattern %s, map %s"),
+        NumPawns, NumFrames, FShibaInputScript::GetPatternName(Pattern), *MapName);
+
+    // Baseline: the empty map, so per-pawn cost excludes the level itself
+    TArray<double> BaselineTimes;
+    BaselineTimes.Reserve(NumBaselineFrames);
+    for (int32 Frame = 0; Frame < NumBaselineFrames; ++Frame)
+    {
+        BaselineTimes.Add(TickWorld(World, DeltaTime));
+    }
+
+    // Spawn the pack on a grid around the first player start
+    FVector Origin(0.0f, 0.0f, 200.0f);
+    for (TActorIterator<APlayerStart> It(World); It; ++It)
+    {
+        Origin = It->GetActorLocation();
+        break;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    const int32 GridSide = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumPawns)));
+    const float Spacing = 300.0f;
+
+    TArray<AShibaCharacter*> Pawns;
+    TArray<FShibaInputScript> Scripts;
+    Pawns.Reserve(NumPawns);
+    Scripts.SetNum(NumPawns);
+
+    for (int32 Index = 0; Index < NumPawns; ++Index)
+    {
+        const FVector Offset((Index % GridSide - GridSide / 2) * Spacing, (Index / GridSide - GridSide / 2) * Spacing, 0.0f);
+        AShibaCharacter* Pawn = World->SpawnActor<AShibaCharacter>(PawnClass, Origin + Offset, FRotator::ZeroRotator, SpawnParams);
+        if (!Pawn)
+        {
+            continue;
+        }
+
+        Pawn->SpawnDefaultController();
+        Scripts[Pawns.Num()].Initialize(Pattern, Seed + Index);
+        Pawns.Add(Pawn);
+    }
+    Scripts.SetNum(Pawns.Num());
+
+    if (Pawns.Num() == 0)
+    {
+        UE_LOG(LogNaughtyShiba, Error, TEXT("No pawns could be spawned"));
+        DestroyWorld(World);
+        return 1;
+    }
+
+    auto StepScripts = [&Pawns, &Scripts, DeltaTime]()
+    {
+        for (int32 Index = 0; Index < Pawns.Num(); ++Index)
+        {
+            Scripts[Index].Step(Pawns[Index], DeltaTime);
+        }
+    };
+
+    for (int32 Frame = 0; Frame < NumWarmupFrames; ++Frame)
+    {
+        StepScripts();
+        TickWorld(World, DeltaTime);
+    }
+
+    // Measured run - input scripting is outside the timed region, allocation counting is inside and limited to this thread
+    static FCountingMalloc* CountingMalloc = new FCountingMalloc(GMalloc);
+
+    TArray<double> FrameTimes;
+    FrameTimes.Reserve(NumFrames);
+    uint64 TotalAllocs = 0;
+    uint64 TotalReallocs = 0;
+
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        StepScripts();
+
+        CountingMalloc->Install();
+        FrameTimes.Add(TickWorld(World, DeltaTime));
+        CountingMalloc->Uninstall();
+
+        TotalAllocs += CountingMalloc->NumAllocs.load();
+        TotalReallocs += CountingMalloc->NumReallocs.load();
+    }
+
+    // Sanity data so a broken run (pawns falling through the map, not moving) is obvious in the report
+    int32 NumGrounded = 0;
+    int32 NumActionsIssued = 0;
+    double TotalSpeed = 0.0;
+    for (int32 Index = 0; Index < Pawns.Num(); ++Index)
+    {
+        NumGrounded += Pawns[Index]->IsGrounded() ? 1 : 0;
+        TotalSpeed += Pawns[Index]->GetCurrentSpeed();
+        NumActionsIssued += Scripts[Index].GetNumActionsIssued();
+    }
+
+    const FFrameStats Baseline = Summarize(BaselineTimes);
+    const FFrameStats Loaded = Summarize(FrameTimes);
+    const int32 NumSpawned = Pawns.Num();
+    const double MsPerPawn = FMath::Max(Loaded.MeanMs - Baseline.MeanMs, 0.0) / NumSpawned;
+
+    // Report
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("map"), MapName);
+    Root->SetStringField(TEXT("pawn_class"), PawnClass->GetPathName());
+    Root->SetStringField(TEXT("pattern"), FShibaInputScript::GetPatternName(Pattern));
+    Root->SetStringField(TEXT("build"), FApp::GetBuildVersion());
+    Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+    Root->SetNumberField(TEXT("pawns"), NumSpawned);
+    Root->SetNumberField(TEXT("frames"), NumFrames);
+    Root->SetNumberField(TEXT("delta_time"), DeltaTime);
+    Root->SetNumberField(TEXT("seed"), Seed);
+
+    Root->SetObjectField(TEXT("baseline_frame"), StatsToJson(Baseline));
+    Root->SetObjectField(TEXT("loaded_frame"), StatsToJson(Loaded));
+    Root->SetNumberField(TEXT("ms_per_pawn_per_frame"), MsPerPawn);
+
+    TSharedRef<FJsonObject> Allocations = MakeShared<FJsonObject>();
+    Allocations->SetNumberField(TEXT("allocs_per_frame"), static_cast<double>(TotalAllocs) / NumFrames);
+    Allocations->SetNumberField(TEXT("reallocs_per_frame"), static_cast<double>(TotalReallocs) / NumFrames);
+    Allocations->SetNumberField(TEXT("allocs_per_pawn_per_frame"), static_cast<double>(TotalAllocs) / NumFrames / NumSpawned);
+    Root->SetObjectField(TEXT("allocations"), Allocations);
+
+    // Standalone run has no net driver and serializes no moves, so this is a static upper bound, not a measurement:
+    // the in-memory size of everything UShibaGMCMovement::BindReplicationData binds, before GMC's own packing
+    // (bools go out as bits, and combined moves send less)
+    constexpr int32 ShibaBoundBytesUpperBound = sizeof(UShibaGMCMovement::InputEdgeFlags) + sizeof(UShibaGMCMovement::InputFlags)
+        + sizeof(UShibaGMCMovement::Stamina) + sizeof(UShibaGMCMovement::bStaminaExhausted)
+        + sizeof(UShibaGMCMovement::bSprintNeedsRepress) + sizeof(UShibaGMCMovement::MoveEndLocation);
+
+    TSharedRef<FJsonObject> MovePacket = MakeShared<FJsonObject>();
+    MovePacket->SetNumberField(TEXT("shiba_bound_bytes_static_upper_bound"), ShibaBoundBytesUpperBound);
+    MovePacket->SetStringField(TEXT("note"), TEXT("Static sizeof sum of the Shiba bound state, not serialized size; excludes GMC base state and packet overhead; use the bot swarm for on-wire bandwidth"));
+    Root->SetObjectField(TEXT("move_packet"), MovePacket);
+
+    TSharedRef<FJsonObject> Sanity = MakeShared<FJsonObject>();
+    Sanity->SetNumberField(TEXT("grounded_pawns"), NumGrounded);
+    Sanity->SetNumberField(TEXT("mean_speed"), TotalSpeed / NumSpawned);
+    Sanity->SetNumberField(TEXT("actions_issued"), NumActionsIssued);
+    Root->SetObjectField(TEXT("sanity"), Sanity);
+
+    FString Json;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    const bool bSaved = FFileHelper::SaveStringToFile(Json, *OutputPath);
+
+    UE_LOG(LogNaughtyShiba, Display, TEXT("Shiba benchmark: %.3f ms/frame (baseline %.3f), %.4f ms per pawn per frame, %.1f allocs/frame"),
+        Loaded.MeanMs, Baseline.MeanMs, MsPerPawn, static_cast<double>(TotalAllocs) / NumFrames);
+
+    if (bSaved)
+    {
+        UE_LOG(LogNaughtyShiba, Display, TEXT("Shiba benchmark report written to %s"), *OutputPath);
+    }
+    else
+    {
+        UE_LOG(LogNaughtyShiba, Error, TEXT("Failed to write benchmark report to %s"), *OutputPath);
+    }
+
+    for (AShibaCharacter* Pawn : Pawns)
+    {
+        if (IsValid(Pawn))
+        {
+            Pawn->Destroy();
+        }
+    }
+    DestroyWorld(World);
+
+    return bSaved ? 0 : 1;
+}
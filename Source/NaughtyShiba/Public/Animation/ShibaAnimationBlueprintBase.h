@@ -5,6 +5,23 @@
 #include "Characters/ShibaCharacter.h"
 #include "ShibaAnimationBlueprintBase.generated.h"
 
+/**
+ * Everything the anim instance needs from the character, copied once per frame on the game thread
+ * Worker-thread animation update only ever reads this, never the character
+ */
+USTRUCT()
+struct FShibaAnimSnapshot
+{
+    GENERATED_BODY()
+
+    FVector Velocity = FVector::ZeroVector;
+    FVector RightVector = FVector::RightVector;
+    EShibaCharacterState State = EShibaCharacterState::Idle;
+    bool bIsGrounded = true;
+    bool bUseReducedGraph = false;
+    bool bIsValid = false;
+};
+
 /**
  * Bare bones Animation Blueprint base class for Shiba character
  * Provides raw character data to Blueprint Animation system
@@ -20,6 +37,7 @@ public:
 protected:
     virtual void NativeInitializeAnimation() override;
     virtual void NativeUpdateAnimation(float DeltaTimeX) override;
+    virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
 
 public:
     // Character reference
@@ -80,8 +98,38 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Animation|Actions")
     bool bIsDigging = false;
 
+    // LOD - ABP_ShibaCharacter blends to its locomotion-only branch when this is set
+    UPROPERTY(BlueprintReadOnly, Category = "Animation|LOD")
+    bool bUseReducedGraph = false;
+
+    // Update rate optimization (URO) settings applied to the owning mesh on initialize
+    UPROPERTY(EditDefaultsOnly, Category = "Animation|LOD")
+    bool bConfigureUpdateRateOptimizations = true;
+
+    // Frames skipped between evaluations, indexed by mesh LOD
+    UPROPERTY(EditDefaultsOnly, Category = "Animation|LOD", meta = (EditCondition = "bConfigureUpdateRateOptimizations"))
+    TArray<int32> FrameSkipPerLOD = { 0, 1, 2, 3 };
+
+    // Interpolate skipped frames while the evaluation rate is at or below this many frames
+    UPROPERTY(EditDefaultsOnly, Category = "Animation|LOD", meta = (EditCondition = "bConfigureUpdateRateOptimizations"))
+    int32 MaxEvalRateForInterpolation = 4;
+
+    // Update rate used while the mesh is not rendered
+    UPROPERTY(EditDefaultsOnly, Category = "Animation|LOD", meta = (EditCondition = "bConfigureUpdateRateOptimizations"))
+    int32 NonRenderedUpdateRate = 8;
+
+    // Mesh LOD at which the reduced graph kicks in (far/culled significance tiers always use it)
+    UPROPERTY(EditDefaultsOnly, Category = "Animation|LOD")
+    int32 ReducedGraphMinLOD = 2;
+
 protected:
-    // Update functions called each frame
+    // Game thread: copy character data into Snapshot
+    void GatherSnapshot();
+
+    // Push URO settings onto the owning mesh
+    void ConfigureUpdateRateOptimizations();
+
+    // Worker thread: derive animation properties from Snapshot only
     void UpdateMovementProperties();
     void UpdateStateProperties();
     void UpdateActionProperties();
@@ -90,6 +138,9 @@ protected:
     float CalculateDirection() const;
 
 private:
+    // Character data for this frame's thread-safe update
+    FShibaAnimSnapshot Snapshot;
+
     // Previous frame values for acceleration calculation
     float PreviousSpeed = 0.0f;
 };
\ No newline at end of file
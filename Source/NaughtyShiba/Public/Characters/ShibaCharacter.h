@@ -6,12 +6,16 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "GMCFlatCapsuleComponent.h"
 #include "Engine/Engine.h"
+#include "Systems/ShibaSignificanceManager.h"
 #include "ShibaCharacter.generated.h"
 
 // Forward declarations
 class UInputManagerComponent;
 class UShibaGMCMovement;
 class USkeletalMeshComponent;
+enum class EShibaStateCondition : uint8;
+enum class EShibaSpeedBand : uint8;
+enum class EShibaActionSlot : uint8;
 
 
 UENUM(BlueprintType)
@@ -36,6 +40,24 @@ enum class EShibaCharacterState : uint8
     Dead           UMETA(DisplayName = "Dead")
 };
 
+/**
+ * Replicated action flags, packed into a single byte on AShibaCharacter
+ * Each bit mirrors one of the bIsX action booleans
+ */
+enum class EShibaActionFlags : uint8
+{
+    None            = 0,
+    Jumping         = 1 << 0,
+    Sprinting       = 1 << 1,
+    Walking         = 1 << 2,
+    Crouching       = 1 << 3,
+    Barking         = 1 << 4,
+    Howling         = 1 << 5,
+    Sniffing        = 1 << 6,
+    CarryingObject  = 1 << 7
+};
+ENUM_CLASS_FLAGS(EShibaActionFlags)
+
 
 
 /**
@@ -98,32 +120,47 @@ public:
 
     // GetVelocity override (no UFUNCTION - inherited from AActor)
     virtual FVector GetVelocity() const override;
+
+    // Significance LOD (driven by UShibaSignificanceManager on clients)
+    void SetSignificanceTier(EShibaSignificanceTier NewTier);
+
+    UFUNCTION(BlueprintCallable, Category = "Performance")
+    EShibaSignificanceTier GetSignificanceTier() const { return SignificanceTier; }
+
+    // False for far/off-screen dogs - skip debug output and optional effects
+    UFUNCTION(BlueprintCallable, Category = "Performance")
+    bool IsCosmeticSignificant() const;
+
+    // True while GMC is resimulating moves after a correction; cosmetic events are not re-broadcast then
+    bool IsReplayingMove() const;
     
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Speed Settings")
+    // Legacy speed settings - only used when UShibaGMCMovement has no MovementConfig asset
+    // Copied into the movement params at BeginPlay/possession, so they are read-only at runtime; use SetLegacySpeedSettings
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Speed Settings")
     float BaseMovementSpeed = 400.0f;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Speed Settings")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Speed Settings")
     float SprintMultiplier = 1.5f;  
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Speed Settings")  
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Speed Settings")  
     float WalkMultiplier = 0.5f;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Speed Settings")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Speed Settings")
     float CrouchMultiplier = 0.3f;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement|Jump")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Jump")
     float JumpVelocity = 450.0f;
 
+    // Changes the legacy speeds and re-flattens them into the movement params (no effect with a MovementConfig)
+    // Must run on the server and owning client alike, or their predictions will disagree
+    UFUNCTION(BlueprintCallable, Category = "Movement|Speed Settings")
+    void SetLegacySpeedSettings(float NewBaseSpeed, float NewSprintMultiplier, float NewWalkMultiplier, float NewCrouchMultiplier, float NewJumpVelocity);
+
+    // Reads the movement component's flattened speed table
     UFUNCTION(BlueprintCallable, Category = "Movement")  
-    float GetCurrentMovementSpeed() const 
-    {
-        if (bIsCrouching) return BaseMovementSpeed * CrouchMultiplier;
-        if (bIsSprinting) return BaseMovementSpeed * SprintMultiplier;  
-        if (bIsWalking) return BaseMovementSpeed * WalkMultiplier;
-        return BaseMovementSpeed;
-    }
+    float GetCurrentMovementSpeed() const;
 
-    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
+    UPROPERTY(BlueprintReadOnly, Category = "Actions")
     bool bIsWalking = false;
     
     // Dog abilities
@@ -220,11 +257,12 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     USkeletalMeshComponent* ShibaMesh;
 
+    // Camera components exist everywhere but are deactivated on dedicated servers
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-    USpringArmComponent* CameraBoom;
+    USpringArmComponent* CameraBoom = nullptr;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-    UCameraComponent* ThirdPersonCamera;
+    UCameraComponent* ThirdPersonCamera = nullptr;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     UInputManagerComponent* InputManager = nullptr;
@@ -233,7 +271,7 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     UShibaGMCMovement* GMCMovementComponent;
 
-    // State management
+    // State management (push-model replicated, dirtied in SetCharacterState)
     UPROPERTY(BlueprintReadOnly, Replicated, Category = "State")
     EShibaCharacterState CurrentState = EShibaCharacterState::Idle;
 
@@ -250,37 +288,74 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
     float CameraLagSpeed = 10.0f;
 
-    // Action states
-    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
+    // Run per-frame character logic from the GMC movement callbacks instead of the actor tick
+    // When enabled the actor tick is switched off in BeginPlay
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Performance")
+    bool bDriveLogicFromMovement = true;
+
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Performance")
+    EShibaSignificanceTier SignificanceTier = EShibaSignificanceTier::Local;
+
+    // Next time a simulated proxy's movement-driven logic may run at its current tier
+    float NextSimulatedLogicTime = 0.0f;
+
+    // Action states - local mirrors of ActionFlags, kept for Blueprint and existing readers
+    UPROPERTY(BlueprintReadOnly, Category = "Actions")
     bool bIsJumping = false;
 
-    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
+    UPROPERTY(BlueprintReadOnly, Category = "Actions")
     bool bIsSprinting = false;
 
-    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
+    UPROPERTY(BlueprintReadOnly, Category = "Actions")
     bool bIsCrouching = false;
 
-    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
+    UPROPERTY(BlueprintReadOnly, Category = "Actions")
     bool bIsBarking = false;
 
-    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
+    UPROPERTY(BlueprintReadOnly, Category = "Actions")
     bool bIsHowling = false;
 
-    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
+    UPROPERTY(BlueprintReadOnly, Category = "Actions")
     bool bIsSniffing = false;
 
-    UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
+    UPROPERTY(BlueprintReadOnly, Category = "Actions")
     bool bIsCarryingObject = false;
 
+    // All action booleans packed into one replicated byte (see EShibaActionFlags)
+    UPROPERTY(ReplicatedUsing = OnRep_ActionFlags)
+    uint8 ActionFlags = 0;
+
     // Carried object reference
     UPROPERTY(BlueprintReadOnly, Replicated, Category = "Actions")
     AActor* CarriedObject = nullptr;
 
+    UFUNCTION()
+    void OnRep_ActionFlags();
+
+    // Set or clear one action flag, update its mirror boolean and mark ActionFlags dirty
+    void SetActionFlag(EShibaActionFlags Flag, bool bEnabled);
+
+    // Copy the packed flags out to the bIsX mirrors
+    void ApplyActionFlags();
+
+    void SetCarriedObject(AActor* NewCarriedObject);
+
     // Network replication
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
     // Helper functions
     virtual void UpdateCharacterState();
+    void EvaluateCharacterState(const FVector& Velocity, bool bGrounded);
+
+    // Per-frame bookkeeping shared by Tick and the movement callbacks (TimeSeconds is move/world time)
+    void UpdateCharacterLogic(float TimeSeconds);
+
+    // Timed action expiry, dispatched by UShibaActionScheduler
+    void OnScheduledActionExpired(EShibaActionSlot Slot);
+
+    // Schedule/cancel timed actions on this world's UShibaActionScheduler
+    void ScheduleAction(EShibaActionSlot Slot, float Duration);
+    void CancelScheduledActions();
     virtual bool IsAnyActionActive() const;
     virtual void CancelAllActions();
 
@@ -297,6 +372,14 @@ private:
     FVector LastValidLocation = FVector::ZeroVector;
     bool bWasGrounded = true;
 
+    // State machine inputs from the last evaluation (state + condition mask + speed band);
+    // starts as FShibaStateMachine::InvalidEvaluationKey so the first evaluation always runs
+    uint32 LastStateEvaluationKey;
+
+    // State machine helpers
+    EShibaStateCondition GetStateConditions(const FVector& Velocity, bool bGrounded) const;
+    EShibaSpeedBand GetSpeedBand(float Speed) const;
+
     // Input event handlers
     UFUNCTION()
     void HandleMoveInput(FVector2D MoveVector);
@@ -342,5 +425,8 @@ private:
     
     UFUNCTION()
     void HandleDefecatePressed();
-    
+
+    // Movement component drives UpdateCharacterLogic from its movement callbacks
+    friend class UShibaGMCMovement;
+    friend class UShibaActionScheduler;
 };
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Characters/ShibaCharacter.h"
+
+/**
+ * Packed conditions the character state machine is keyed on
+ * One bit per input/action flag plus the environmental bits the old if-chain queried
+ */
+enum class EShibaStateCondition : uint8
+{
+    None        = 0,
+    Grounded    = 1 << 0,
+    Swimming    = 1 << 1,
+    Descending  = 1 << 2,   // Vertical velocity <= 0 (ends the Jumping state)
+    Barking     = 1 << 3,
+    Howling     = 1 << 4,
+    Sniffing    = 1 << 5,
+    Crouching   = 1 << 6,
+    Sprinting   = 1 << 7
+};
+ENUM_CLASS_FLAGS(EShibaStateCondition)
+
+/**
+ * Speed bands used by the movement states (Idle/Walking/Running/Sprinting)
+ * Only a change of band can change the movement state, so raw speed is never part of the key
+ */
+enum class EShibaSpeedBand : uint8
+{
+    Stationary  = 0,
+    Walk        = 1,
+    Run         = 2,
+    Sprint      = 3
+};
+
+/**
+ * Compiled transition table for AShibaCharacter
+ * The transition rules are evaluated once for every (state class, conditions, speed band)
+ * combination and stored in a flat lookup table; runtime evaluation is a single array read
+ */
+struct NAUGHTYSHIBA_API FShibaStateMachine
+{
+    // Resolve the state the character should be in; returns CurrentState when no transition applies
+    static EShibaCharacterState Resolve(EShibaCharacterState CurrentState, EShibaStateCondition Conditions, EShibaSpeedBand SpeedBand);
+
+    // Pack everything the table depends on into one key so callers can skip unchanged frames
+    static uint32 MakeEvaluationKey(EShibaCharacterState CurrentState, EShibaStateCondition Conditions, EShibaSpeedBand SpeedBand)
+    {
+        return static_cast<uint32>(CurrentState)
+            | (static_cast<uint32>(Conditions) << 8)
+            | (static_cast<uint32>(SpeedBand) << 16);
+    }
+
+    // Key value that never matches a real evaluation (forces the next evaluation to run)
+    static constexpr uint32 InvalidEvaluationKey = MAX_uint32;
+};
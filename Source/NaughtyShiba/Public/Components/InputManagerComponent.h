@@ -28,6 +28,22 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnHowlPressed);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnHowlReleased);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDefecatePressed);
 
+// Discrete input actions, used to inject synthetic input (benchmarks, bots)
+UENUM(BlueprintType)
+enum class EShibaInputAction : uint8
+{
+    Jump,
+    Sprint,
+    Crouch,
+    Bark,
+    Howl,
+    SniffVision,
+    MarkTerritory,
+    PickUp,
+    Defecate,
+    Interact
+};
+
 /**
  * Enhanced Input Manager Component for Naughty Shiba
  * Centralizes all input handling and provides clean event system
@@ -80,6 +96,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input")
     FVector2D GetLookInput() const { return CurrentLookInput; }
 
+    // Synthetic input - runs the same handlers Enhanced Input does, so listeners can't tell the difference
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    void InjectMoveInput(FVector2D MoveVector);
+
+    // Press or release an action; press-only actions ignore the release
+    UFUNCTION(BlueprintCallable, Category = "Input")
+    void InjectAction(EShibaInputAction Action, bool bPressed);
+
     // Event delegates
     UPROPERTY(BlueprintAssignable, Category = "Input Events")
     FOnMoveInput OnMoveInput;
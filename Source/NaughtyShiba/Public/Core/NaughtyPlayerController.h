@@ -31,8 +31,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Debug")
 	void OpenDebugConsole();
 
+	// Load testing - clients report their prediction counters so the server can see correction rates
+	UFUNCTION(Server, Unreliable)
+	void ServerReportMovementStats(int32 NumReplays, int32 NumMoves);
+
+	int32 GetReportedReplays() const { return ReportedReplays; }
+	int32 GetReportedMoves() const { return ReportedMoves; }
+
 private:
 	// Debug console reference
 	UPROPERTY()
 	class UDebugConsole* DebugConsole;
+
+	// Totals accumulated from the owning client's reports (server only); keep growing across respawns
+	int32 ReportedReplays = 0;
+	int32 ReportedMoves = 0;
+
+	// Client counters from the last report; the client's counters restart with a new pawn or movement component
+	int32 LastClientReplays = 0;
+	int32 LastClientMoves = 0;
 };
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "NaughtyReplicationGraph.generated.h"
+
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_AlwaysRelevant_ForConnection;
+
+/**
+ * How an actor class is routed into the graph
+ */
+enum class ENaughtyRepNodeMapping : uint8
+{
+    NotRouted,                  // Not replicated through the graph
+    RelevantAllConnections,     // Game state, player states - every connection, every frame
+    OwnerOnly,                  // bOnlyRelevantToOwner (controllers) - owning connection only
+
+    // Spatialized (grid) policies
+    Spatialize_Static,          // Never moves - placed in grid cells once
+    Spatialize_Dynamic,         // Moves every frame - Shiba pawns, carried props
+    Spatialize_Dormancy,        // Mostly still and dormant (territory markers) - static while dormant, dynamic while awake
+};
+
+/**
+ * Replication graph for Naughty Shiba
+ * Replaces per-actor relevancy checks (connections x actors) with a 2D grid for pawns and props, a shared
+ * always-relevant list for game/player state, and per-connection lists for owner-only actors
+ *
+ * Enabled through ReplicationDriverClassName in DefaultEngine.ini; grid settings live in the same file
+ * Actors like territory markers should start dormant (NetDormancy = DORM_Initial) to get the dormancy policy
+ */
+UCLASS(Transient, Config = Engine)
+class NAUGHTYSHIBA_API UNaughtyReplicationGraph : public UReplicationGraph
+{
+    GENERATED_BODY()
+
+public:
+    // UReplicationGraph interface
+    virtual void InitGlobalActorClassSettings() override;
+    virtual void InitGlobalGraphNodes() override;
+    virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+    virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+    virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+    virtual void PrepareForReplication() override;
+
+    // Grid cell size (cm); roughly the Shiba cull distance so each pawn touches few cells
+    UPROPERTY(Config)
+    float GridCellSize = 10000.0f;
+
+    // Offset so the grid covers negative world coordinates without growing
+    UPROPERTY(Config)
+    FVector2D GridSpatialBias = FVector2D(-150000.0f, -150000.0f);
+
+    // Actors outside the biased grid would force a rebuild; clamp them instead
+    UPROPERTY(Config)
+    bool bDisableSpatialRebuilds = true;
+
+protected:
+    virtual void OnRemoveConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+
+private:
+    ENaughtyRepNodeMapping GetMappingPolicy(UClass* Class);
+    void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const;
+    UReplicationGraphNode_AlwaysRelevant_ForConnection* GetAlwaysRelevantNodeForConnection(UNetConnection* Connection) const;
+
+    static bool IsSpatialized(ENaughtyRepNodeMapping Mapping) { return Mapping >= ENaughtyRepNodeMapping::Spatialize_Static; }
+
+    // Explicit routes for known classes, filled in from actor defaults for everything else on first use
+    TClassMap<ENaughtyRepNodeMapping> ClassRepNodePolicies;
+
+    UPROPERTY()
+    UReplicationGraphNode_GridSpatialization2D* GridNode = nullptr;
+
+    UPROPERTY()
+    UReplicationGraphNode_ActorList* AlwaysRelevantNode = nullptr;
+
+    UPROPERTY()
+    TMap<UNetConnection*, UReplicationGraphNode_AlwaysRelevant_ForConnection*> AlwaysRelevantForConnection;
+
+    // Owner-only actors that were added before their owner had a connection
+    UPROPERTY()
+    TArray<AActor*> ActorsWithoutNetConnection;
+};
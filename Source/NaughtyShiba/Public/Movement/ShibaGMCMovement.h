@@ -2,11 +2,32 @@
 
 #include "CoreMinimal.h"
 #include "GMCOrganicMovementComponent.h"
+#include "Movement/ShibaMovementParams.h"
+#include "Movement/ShibaNetStats.h"
 #include "ShibaGMCMovement.generated.h"
 
 // Forward declarations
 class AShibaCharacter;
 class UDebugConsole;
+class UShibaMovementConfig;
+class UPhysicalMaterial;
+class UPrimitiveComponent;
+
+/**
+ * Input bits bound to GMC as two integers
+ * Held inputs combine only while unchanged; edge inputs (jump) always combine
+ */
+enum class EShibaInputFlags : int32
+{
+    None    = 0,
+    Jump    = 1 << 0,   // Edge mask
+    Sprint  = 1 << 1,
+    Crouch  = 1 << 2,
+    Bark    = 1 << 3,
+    Sniff   = 1 << 4,
+    Howl    = 1 << 5
+};
+ENUM_CLASS_FLAGS(EShibaInputFlags)
 
 /**
  * Custom GMC Organic Movement Component for Shiba Character
@@ -22,39 +43,92 @@ public:
 
     // Input flag accessors for character to use
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
-    void SetWantsToSprint(bool bWants) { bWantsToSprint = bWants; }
+    void SetWantsToSprint(bool bWants) { SetInputFlag(EShibaInputFlags::Sprint, bWants); }
     
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")  
-    void SetWantsToCrouch(bool bWants) { bWantsToCrouch = bWants; }
+    void SetWantsToCrouch(bool bWants) { SetInputFlag(EShibaInputFlags::Crouch, bWants); }
     
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
     void SetWantsToJump(bool bWants);
     
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
-    void SetWantsToBark(bool bWants) { bWantsToBark = bWants; }
+    void SetWantsToBark(bool bWants) { SetInputFlag(EShibaInputFlags::Bark, bWants); }
     
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
-    void SetWantsToSniff(bool bWants) { bWantsToSniff = bWants; }
+    void SetWantsToSniff(bool bWants) { SetInputFlag(EShibaInputFlags::Sniff, bWants); }
+
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
+    void SetWantsToHowl(bool bWants) { SetInputFlag(EShibaInputFlags::Howl, bWants); }
 
     // Getter functions for debugging
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
-    bool GetWantsToSprint() const { return bWantsToSprint; }
+    bool GetWantsToSprint() const { return HasInputFlag(EShibaInputFlags::Sprint); }
     
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
-    bool GetWantsToCrouch() const { return bWantsToCrouch; }
+    bool GetWantsToCrouch() const { return HasInputFlag(EShibaInputFlags::Crouch); }
+
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
+    bool GetWantsToJump() const { return HasInputFlag(EShibaInputFlags::Jump); }
+
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
+    bool GetWantsToBark() const { return HasInputFlag(EShibaInputFlags::Bark); }
+
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
+    bool GetWantsToSniff() const { return HasInputFlag(EShibaInputFlags::Sniff); }
 
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
-    void SetWantsToHowl(bool bWants) { bWantsToHowl = bWants; }
+    bool GetWantsToHowl() const { return HasInputFlag(EShibaInputFlags::Howl); }
+
+    // Movement tuning data - set per breed; flattened into MovementParams by ApplyMovementConfig
+    // Without a config the character's legacy speed fields are used, as they were at the last ApplyMovementConfig
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Shiba Movement")
+    UShibaMovementConfig* MovementConfig = nullptr;
+
+    // Re-flatten MovementConfig (called at BeginPlay and possession)
+    void ApplyMovementConfig();
+
+    const FShibaMovementParams& GetMovementParams() const { return MovementParams; }
+
+    // Max speed for the character's current action flags
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
+    float GetCurrentModeSpeed() const;
+
+    // Speed multiplier for the surface currently stood on (1.0 in the air, swimming or without a config)
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
+    float GetSurfaceSpeedMultiplier() const;
+
+    // Stamina (predicted, bound through GMC)
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement|Stamina")
+    float GetStamina() const { return Stamina; }
+
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement|Stamina")
+    float GetMaxStamina() const { return MovementParams.MaxStamina; }
+
+    // True from running dry until stamina regenerates past LowStaminaThreshold; sprint is blocked meanwhile
+    UFUNCTION(BlueprintCallable, Category = "Shiba Movement|Stamina")
+    bool IsStaminaExhausted() const { return bStaminaExhausted; }
+
+    // Prediction quality (corrections on the owning client, smoothing on simulated proxies) plus connection health
+    UFUNCTION(BlueprintPure, Category = "Shiba Movement|Network")
+    FShibaNetStats GetNetStats() const;
+
+    // Client prediction counters (autonomous proxy only) - a replay means the server corrected us
+    uint32 GetNumClientReplays() const { return NetStats.GetStats().TotalCorrections; }
+    uint32 GetNumClientMoves() const { return NetStats.GetStats().TotalPredictedMoves; }
 
     virtual FVector PreProcessInputVector_Implementation(FVector InRawInputVector) override;
     virtual void SetupPlayerInputComponent_Implementation(UInputComponent* PlayerInputComponent) override;
     
 protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     // GMC Override Functions - Core movement logic
     virtual void BindReplicationData_Implementation() override;
     virtual void PreMovementUpdate_Implementation(float DeltaTime) override;
     virtual void MovementUpdate_Implementation(float DeltaTime) override;
     virtual void PostMovementUpdate_Implementation(float DeltaTime) override;
+    virtual void MovementUpdateSimulated_Implementation(float DeltaTime) override;
     
     // Get owning Shiba character
     UFUNCTION(BlueprintCallable, Category = "Shiba Movement")
@@ -62,12 +136,26 @@ protected:
 
 private:
     // Input flags for GMC replication (PRIVATE - implementation details)
-    bool bWantsToJump = false;
-    bool bWantsToSprint = false;
-    bool bWantsToCrouch = false;
-    bool bWantsToBark = false;
-    bool bWantsToSniff = false;
-    bool bWantsToHowl = false;
+    // Held inputs (sprint, crouch, bark, sniff, howl) - CombineIfUnchanged
+    int32 InputFlags = 0;
+
+    // Edge inputs (jump) - AlwaysCombine for responsive jumps
+    int32 InputEdgeFlags = 0;
+
+    // Edge inputs live in InputEdgeFlags, everything else in InputFlags
+    static constexpr EShibaInputFlags EdgeInputMask = EShibaInputFlags::Jump;
+
+    void SetInputFlag(EShibaInputFlags Flag, bool bEnabled)
+    {
+        int32& Mask = EnumHasAnyFlags(EdgeInputMask, Flag) ? InputEdgeFlags : InputFlags;
+        Mask = bEnabled ? (Mask | static_cast<int32>(Flag)) : (Mask & ~static_cast<int32>(Flag));
+    }
+
+    bool HasInputFlag(EShibaInputFlags Flag) const
+    {
+        const int32 Mask = EnumHasAnyFlags(EdgeInputMask, Flag) ? InputEdgeFlags : InputFlags;
+        return (Mask & static_cast<int32>(Flag)) != 0;
+    }
 
     // Cached input manager reference
     UPROPERTY()
@@ -77,6 +165,37 @@ private:
     UPROPERTY()
     UDebugConsole* DebugConsole;
 
+    // Stamina - server authoritative output, validated against the client's prediction every move
+    float Stamina = 100.0f;
+    bool bStaminaExhausted = false;
+
+    // Set when exhaustion drops a sprint, cleared once the sprint input is released (bound so replays edge-detect the same way)
+    bool bSprintNeedsRepress = false;
+
+    // Drain while sprinting on the ground, regenerate otherwise; runs once per (re)simulated move
+    void UpdateStamina(float DeltaTime);
+
+    // True when this move resolves to the Sprint speed mode, derived from bound state only
+    bool IsSprintMove() const;
+
+    // Count predicted moves and the replays that follow server corrections
+    void TrackClientPrediction();
+
+    // Simulated proxies: compare each rendered location with the interpolated server location
+    void TrackSimulatedSmoothing(float DeltaTime);
+
+    FShibaNetStatsCollector NetStats;
+    bool bWasReplaying = false;
+
+    // Set from PreMovementUpdate to PostMovementUpdate so the character can anchor timed actions to the move
+    bool bInPredictedMove = false;
+
+    // Where the last fresh (non-replayed) move ended, to measure how far a correction moved us
+    FVector LastPredictedLocation = FVector::ZeroVector;
+
+    // Location at the end of the last simulated move; bound so simulated proxies receive it as their smoothing target
+    FVector MoveEndLocation = FVector::ZeroVector;
+
     // Movement state tracking (PRIVATE - implementation details)
     float LastSpeedChangeTime = 0.0f;
     bool bWasMovingLastFrame = false;
@@ -84,6 +203,27 @@ private:
     // Movement helper functions (PRIVATE - implementation details)
     void ProcessDogInput(float DeltaTime);
 
+    // Flattened tuning for this pawn - the only thing the per-move path reads
+    FShibaMovementParams MovementParams;
+
+    EShibaSpeedMode ResolveSpeedMode(const AShibaCharacter* ShibaChar) const;
+
+    // Surface response - multipliers come from MovementParams.SurfaceSpeedTable
+    float LookupSurfaceSpeedMultiplier(const UPrimitiveComponent* FloorComponent, const UPhysicalMaterial* FloorMaterial) const;
+
+    // Last floor seen and its multiplier - consecutive moves almost always stand on the same floor
+    mutable TWeakObjectPtr<const UPrimitiveComponent> CachedFloorComponent;
+    mutable TWeakObjectPtr<const UPhysicalMaterial> CachedFloorMaterial;
+    mutable float CachedSurfaceMultiplier = 1.0f;
+
+#if WITH_EDITOR
+    void HandleMovementConfigChanged(const UShibaMovementConfig* ChangedConfig);
+    FDelegateHandle ConfigChangedHandle;
+#endif
+
     // Make these public properties accessible to private methods
     friend class AShibaCharacter;
+
+    // Sizes the bound state for its move packet report
+    friend class UShibaMovementBenchmarkCommandlet;
 };
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "Chaos/ChaosEngineInterface.h"
+#include "Movement/ShibaMovementParams.h"
 #include "ShibaMovementConfig.generated.h"
 
 /**
@@ -81,9 +83,37 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Surface")
     float IceSpeedMultiplier = 0.3f;
 
+    // Wading on a WaterSurface floor; swimming speed is SwimSpeed alone
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Surface")
     float WaterSpeedMultiplier = 0.5f;
 
+    // Physical surface types (Project Settings > Physics) mapped to the multipliers above
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Surface")
+    TEnumAsByte<EPhysicalSurface> GrassSurface = SurfaceType1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Surface")
+    TEnumAsByte<EPhysicalSurface> MudSurface = SurfaceType2;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Surface")
+    TEnumAsByte<EPhysicalSurface> IceSurface = SurfaceType3;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Surface")
+    TEnumAsByte<EPhysicalSurface> WaterSurface = SurfaceType4;
+
+    // Multiplier for a surface type; unmapped surfaces move at full speed
+    float GetSurfaceSpeedMultiplier(EPhysicalSurface SurfaceType) const;
+
+    // Resolve everything into the flat per-pawn block used by UShibaGMCMovement
+    void FlattenInto(FShibaMovementParams& OutParams) const;
+
+#if WITH_EDITOR
+    // Fired when the asset is edited (including during PIE) so pawns can re-flatten
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnMovementConfigChanged, const UShibaMovementConfig*);
+    static FOnMovementConfigChanged OnMovementConfigChanged;
+
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
     // Stamina parameters
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Movement|Stamina")
     float MaxStamina = 100.0f;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/ChaosEngineInterface.h"
+#include "Containers/StaticArray.h"
+
+/**
+ * Speed modes indexing FShibaMovementParams::SpeedTable, in resolution priority order
+ */
+enum class EShibaSpeedMode : uint8
+{
+    Swim,       // Owns the water slowdown; surface multipliers don't apply while swimming
+    Crouch,
+    Sprint,
+    Walk,
+    Carry,
+    Sniff,
+    Run,        // Default
+    Count
+};
+
+/**
+ * Flattened movement tuning for one pawn
+ * Built from UShibaMovementConfig (or the character's legacy speed fields) at possession,
+ * so the per-move path reads plain values instead of chasing the data asset
+ */
+struct FShibaMovementParams
+{
+    // Max speed per EShibaSpeedMode
+    TStaticArray<float, (int32)EShibaSpeedMode::Count> SpeedTable;
+
+    // Surface speed multiplier per EPhysicalSurface
+    TStaticArray<float, SurfaceType_Max> SurfaceSpeedTable;
+
+    float JumpVelocity = 450.0f;
+
+    // Stamina
+    float MaxStamina = 100.0f;
+    float SprintStaminaDrain = 20.0f;
+    float StaminaRegenRate = 15.0f;
+    float LowStaminaThreshold = 20.0f;
+
+    FShibaMovementParams()
+    {
+        for (float& Speed : SpeedTable)
+        {
+            Speed = 400.0f;
+        }
+        for (float& Multiplier : SurfaceSpeedTable)
+        {
+            Multiplier = 1.0f;
+        }
+    }
+
+    float GetSpeed(EShibaSpeedMode Mode) const { return SpeedTable[(int32)Mode]; }
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ShibaNetStats.generated.h"
+
+/**
+ * Prediction quality for one Shiba, published once per second for WBP_NetworkDebug
+ * Correction fields are filled on the owning client, smoothing fields on simulated proxies
+ */
+USTRUCT(BlueprintType)
+struct FShibaNetStats
+{
+    GENERATED_BODY()
+
+    // Server corrections (replay batches) over the last second
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float CorrectionsPerSecond = 0.0f;
+
+    // Distance between the original prediction and the corrected one (cm)
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float AverageCorrectionDistance = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float MaxCorrectionDistance = 0.0f;
+
+    // Moves re-simulated per correction - grows with latency
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float ReplayedMovesPerCorrection = 0.0f;
+
+    // Simulated proxies: how far the rendered location is from the interpolated server location (cm)
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float AverageSmoothingError = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float MaxSmoothingError = 0.0f;
+
+    // Totals since spawn
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    int32 TotalCorrections = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    int32 TotalReplayedMoves = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    int32 TotalPredictedMoves = 0;
+
+    // Connection, filled in when queried
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float PingMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float InPacketLossPercent = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Net Stats")
+    float OutPacketLossPercent = 0.0f;
+};
+
+/**
+ * Accumulates prediction samples and rolls them into FShibaNetStats every second
+ */
+class FShibaNetStatsCollector
+{
+public:
+    void AddPredictedMove();
+    void AddReplayedMove();
+    void AddCorrection(float Distance);
+    void AddSmoothingSample(float Error);
+
+    // Publishes the window once it is a second old
+    void Update(double TimeSeconds);
+
+    const FShibaNetStats& GetStats() const { return Stats; }
+
+private:
+    FShibaNetStats Stats;
+
+    double WindowStart = -1.0;
+    int32 WindowCorrections = 0;
+    int32 WindowReplayedMoves = 0;
+    float WindowCorrectionSum = 0.0f;
+    float WindowCorrectionMax = 0.0f;
+    int32 WindowSmoothingSamples = 0;
+    float WindowSmoothingSum = 0.0f;
+    float WindowSmoothingMax = 0.0f;
+};
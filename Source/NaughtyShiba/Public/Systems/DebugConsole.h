@@ -44,7 +44,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Debug")
     void LogError(const FString& Message);
 
-    // Performance monitoring
+    // Performance monitoring - Blueprint counterpart of NAUGHTY_PROFILE_SCOPE; timers nest and feed the same zones
     UFUNCTION(BlueprintCallable, Category = "Debug")
     void StartPerformanceTimer(const FString& TimerName);
     
@@ -67,6 +67,9 @@ private:
     void HandlePlayersCommand(const TArray<FString>& Args);
     void HandlePerfMonCommand(const TArray<FString>& Args);
     void HandleTimeSyncCommand(const TArray<FString>& Args);
+    void HandleProfileCommand(const TArray<FString>& Args);
+    void HandleChannelCommand(const TArray<FString>& Args);
+    void HandleDebugDrawCommand(const TArray<FString>& Args);
 
     // Core Systems debug commands
     void HandleInputCommand(const TArray<FString>& Args);
@@ -86,9 +89,12 @@ private:
     // Internal state
     static UDebugConsole* Instance;
     TMap<FString, TFunction<void(const TArray<FString>&)>> Commands;
-    TMap<FString, double> PerformanceTimers;
+    TArray<TPair<FName, uint64>> PerformanceTimerStack;
     bool bDebugDisplayEnabled = false;
     
+    // On-screen output goes through the world's debug draw batcher when there is one
+    void AddScreenMessage(const FString& Message, const FColor& Color);
+
     // Initialization
     void InitializeCommands();
     void RegisterCommand(const FString& CommandName, TFunction<void(const TArray<FString>&)> Handler, const FString& Description = TEXT(""));
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Debug message channels, all off by default
+ * Toggle with the 'channel' console command or -NaughtyDebugChannels=Movement,Abilities on the command line
+ */
+enum class ENaughtyDebugChannel : uint8
+{
+    Movement,       // GMC input flag processing
+    Abilities,      // Bark, howl, sniff, mark, defecate, pick up
+    Anim,
+    Input,          // Raw key presses
+    Num
+};
+
+class NAUGHTYSHIBA_API FNaughtyDebugChannels
+{
+public:
+    static bool IsEnabled(ENaughtyDebugChannel Channel)
+    {
+        return (EnabledMask.load(std::memory_order_relaxed) & (1u << (uint32)Channel)) != 0;
+    }
+
+    static void SetEnabled(ENaughtyDebugChannel Channel, bool bEnabled);
+    static void SetAllEnabled(bool bEnabled);
+
+    static const TCHAR* GetName(ENaughtyDebugChannel Channel);
+    static bool FindChannel(const FString& Name, ENaughtyDebugChannel& OutChannel);
+
+    // Reads -NaughtyDebugChannels= (module startup)
+    static void InitFromCommandLine();
+
+    // Log plus on-screen message; only reached once the channel is known to be on
+    static void Print(ENaughtyDebugChannel Channel, const FColor& Color, float Duration, const FString& Message);
+
+private:
+    static std::atomic<uint32> EnabledMask;
+};
+
+// Arguments are only evaluated and formatted when the channel is enabled; compiled out with NAUGHTY_DEBUG=0
+#if NAUGHTY_DEBUG
+#define NAUGHTY_DEBUG_MSG(Channel, Color, Duration, Format, ...) \
+do \
+{ \
+if (FNaughtyDebugChannels::IsEnabled(ENaughtyDebugChannel::Channel)) \
+{ \
+FNaughtyDebugChannels::Print(ENaughtyDebugChannel::Channel, Color, Duration, FString::Printf(Format, ##__VA_ARGS__)); \
+} \
+} while (0)
+#else
+#define NAUGHTY_DEBUG_MSG(Channel, Color, Duration, Format, ...)
+#endif
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/LineBatchComponent.h"
+#include "NaughtyDebugDraw.generated.h"
+
+class UCanvas;
+class APlayerController;
+
+/**
+ * Per-world batcher for debug text and shapes
+ * Requests accumulate into preallocated buffers and are flushed once per frame: shapes as one line-batcher
+ * submission, text as one canvas pass. Keyed text replaces its previous entry and repeated text is merged,
+ * so per-frame callers don't flood the on-screen message list.
+ *
+ * Anything past the per-frame budget is dropped and counted, keeping debug builds with many dogs representative
+ */
+UCLASS()
+class NAUGHTYSHIBA_API UNaughtyDebugDrawSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Tickable interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UNaughtyDebugDrawSubsystem* Get(const UObject* WorldContextObject);
+
+    // Text stays up for Duration seconds; a non-None Key replaces the previous message with that key
+    void AddText(const FString& Message, const FColor& Color, float Duration, FName Key = NAME_None);
+
+    // Shapes last one frame by default - call every frame to keep them up, or pass a LifeTime in seconds
+    void AddSphere(const FVector& Center, float Radius, const FColor& Color, float LifeTime = 0.0f, float Thickness = 0.0f);
+    void AddCircle(const FVector& Center, float Radius, const FColor& Color, float LifeTime = 0.0f, float Thickness = 0.0f);
+
+    void SetLineBudget(int32 NewBudget) { LineBudget = FMath::Max(NewBudget, 0); }
+    int32 GetLineBudget() const { return LineBudget; }
+
+    // Last flush, for the debugdraw console command
+    int32 GetLastLineCount() const { return LastLineCount; }
+    int32 GetLastDroppedShapes() const { return LastDroppedShapes; }
+    int32 GetNumTextEntries() const { return TextEntries.Num(); }
+
+    static constexpr int32 MaxTextEntries = 32;
+    static constexpr int32 MaxShapes = 512;
+    static constexpr int32 SphereSegments = 12;     // Per ring; spheres draw three rings
+    static constexpr int32 CircleSegments = 32;
+
+private:
+    struct FTextEntry
+    {
+        FName Key;
+        FString Message;
+        FColor Color;
+        double ExpireTime = 0.0;
+        int32 Count = 1;
+    };
+
+    struct FShape
+    {
+        FVector Center;
+        float Radius;
+        FColor Color;
+        float LifeTime;
+        float Thickness;
+        bool bSphere;
+    };
+
+    void FlushShapes();
+    void DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController);
+    void AddCircleLines(const FShape& Shape, const FVector& AxisX, const FVector& AxisY, int32 Segments);
+
+    TArray<FTextEntry> TextEntries;
+    TArray<FShape> Shapes;
+    TArray<FBatchedLine> LineScratch;
+
+    int32 LineBudget = 4096;
+    int32 DroppedShapes = 0;
+    int32 LastLineCount = 0;
+    int32 LastDroppedShapes = 0;
+
+    FDelegateHandle DrawHandle;
+};
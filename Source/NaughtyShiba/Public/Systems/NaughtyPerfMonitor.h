@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Systems/ShibaSignificanceManager.h"
+#include "Systems/NaughtyProfiler.h"
+#include "NaughtyPerfMonitor.generated.h"
+
+class UCanvas;
+class APlayerController;
+
+/**
+ * One fixed-rate perf sample; all times are per-frame averages over the sample interval (ms)
+ */
+struct FNaughtyPerfSample
+{
+    float TimeSeconds = 0.0f;
+    float FrameMs = 0.0f;
+    float GameThreadMs = 0.0f;
+    float RenderThreadMs = 0.0f;
+
+    // From the NAUGHTY_PROFILE_SCOPE_CATEGORY zones of each category
+    float CharacterMs = 0.0f;
+    float MovementMs = 0.0f;
+    float AnimationMs = 0.0f;       // Includes worker-thread anim update
+    float UIMs = 0.0f;
+    float SaveMs = 0.0f;
+
+    float NetInKBps = 0.0f;
+    float NetOutKBps = 0.0f;
+
+    // Indexed by EShibaSignificanceTier
+    int32 DogsPerTier[(int32)EShibaSignificanceTier::Culled + 1] = {};
+};
+
+/**
+ * Live performance monitor behind the 'perfmon' console command
+ * Samples frame, thread, per-system and network costs at a fixed rate into a ring buffer; the overlay and
+ * 'perfmon csv' both read from that buffer, so nothing is formatted per frame
+ */
+UCLASS()
+class NAUGHTYSHIBA_API UNaughtyPerfMonitor : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Tickable interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UNaughtyPerfMonitor* Get(const UObject* WorldContextObject);
+
+    void SetOverlayVisible(bool bVisible);
+    bool IsOverlayVisible() const { return bOverlayVisible; }
+
+    // Writes the buffered series oldest-first; returns false if the file could not be written
+    bool DumpCsv(const FString& FilePath) const;
+
+    int32 GetNumSamples() const { return NumSamples; }
+
+    // 0 is the oldest buffered sample
+    const FNaughtyPerfSample& GetSample(int32 Index) const;
+
+    static constexpr float SampleInterval = 0.1f;
+    static constexpr int32 MaxSamples = 600;        // One minute of history
+
+private:
+    void TakeSample();
+    void RebuildOverlayText();
+    void DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController);
+
+    TArray<FNaughtyPerfSample> Samples;
+    int32 NextSample = 0;
+    int32 NumSamples = 0;
+
+    // Accumulated between samples
+    float TimeUntilSample = 0.0f;
+    double FrameMsSum = 0.0;
+    double GameThreadMsSum = 0.0;
+    double RenderThreadMsSum = 0.0;
+    int32 NumFrames = 0;
+
+    // Profiler category totals at the previous sample
+    uint64 LastCategoryCycles[(int32)ENaughtyProfileCategory::Num] = {};
+
+    // Profiler time spent in a system since the last sample
+    double ConsumeSystemMs(ENaughtyProfileCategory Category);
+
+    bool bOverlayVisible = false;
+    TArray<FString> OverlayLines;
+    FDelegateHandle DrawHandle;
+};
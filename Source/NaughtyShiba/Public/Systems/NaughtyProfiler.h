@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <atomic>
+
+#ifndef NAUGHTY_PROFILING
+#define NAUGHTY_PROFILING !UE_BUILD_SHIPPING
+#endif
+
+/**
+ * System a zone's time is billed to in the perf monitor
+ */
+enum class ENaughtyProfileCategory : uint8
+{
+    None,
+    Character,
+    Movement,
+    Animation,
+    UI,
+    Save,
+    Num
+};
+
+/**
+ * Rolling timing summary for one zone over the last published window
+ */
+struct FNaughtyProfileZoneStats
+{
+    FName Name;
+    int32 Count = 0;        // Samples in the window
+    double MinMs = 0.0;
+    double AvgMs = 0.0;
+    double P95Ms = 0.0;
+    double P99Ms = 0.0;
+    double MaxMs = 0.0;
+};
+
+/**
+ * Lock-free profiling zones
+ * Each zone owns two log-scale histograms of atomic counters; recording from any thread is a handful of relaxed
+ * atomic adds, and once a second the active histogram is swapped out and summarized into FNaughtyProfileZoneStats.
+ * A sample racing the swap is counted one window late.
+ *
+ * Use NAUGHTY_PROFILE_SCOPE(Name) rather than calling this directly - it also emits an Unreal Insights CPU event
+ */
+class NAUGHTYSHIBA_API FNaughtyProfiler
+{
+public:
+    static constexpr int32 MaxZones = 256;
+    static constexpr int32 NumBuckets = 96;         // Quarter-octave buckets from 0.25us to ~4s
+
+    // Same name returns the same zone; call sites cache the id in a function static
+    static int32 RegisterZone(FName Name, ENaughtyProfileCategory Category = ENaughtyProfileCategory::None);
+
+    // Scope entry/exit; EnterZone only tracks category nesting on the calling thread, so every Record needs one
+    static void EnterZone(int32 ZoneId);
+    static void Record(int32 ZoneId, uint64 Cycles);
+
+    // Span timed outside a scope (Blueprint timers); fills the zone's histogram without touching category totals
+    static void RecordSpan(int32 ZoneId, uint64 Cycles);
+
+    // Swap histograms and publish the finished window (called once a second on the game thread)
+    static void PublishWindow();
+
+    static void GetZoneStats(TArray<FNaughtyProfileZoneStats>& OutStats);
+
+    // Cycles recorded for a category since startup, counting only the outermost zone of that category on each thread,
+    // so zones nested in the same category (and zones added later) are billed exactly once. Exclusive: time inside a
+    // nested zone of another category is billed to that category instead (uncategorized zones are transparent)
+    static uint64 GetCategoryTotalCycles(ENaughtyProfileCategory Category);
+    static void Reset();
+
+    // Hook the once-a-second publish into the core ticker (module startup/shutdown)
+    static void Startup();
+    static void Shutdown();
+
+private:
+    struct FHistogram
+    {
+        std::atomic<uint32> Buckets[NumBuckets];
+        std::atomic<uint64> Count;
+        std::atomic<uint64> SumCycles;
+        std::atomic<uint64> MinCycles;
+        std::atomic<uint64> MaxCycles;
+
+        void Clear();
+    };
+
+    struct FZone
+    {
+        FName Name;
+        ENaughtyProfileCategory Category;
+        FHistogram Histograms[2];
+        FNaughtyProfileZoneStats Published;
+    };
+
+    static int32 GetBucket(uint64 Cycles);
+    static double GetBucketUpperMs(int32 Bucket);
+
+    static FZone Zones[MaxZones];
+    static std::atomic<int32> NumZones;
+    static std::atomic<uint64> CategoryCycles[(int32)ENaughtyProfileCategory::Num];
+    static std::atomic<int32> ActiveHistogram;
+    static FCriticalSection RegistryLock;       // Registration and publishing only, never on the record path
+};
+
+/**
+ * RAII timer for one zone; nests freely since each scope only records its own duration
+ */
+class FNaughtyProfileScope
+{
+public:
+    explicit FNaughtyProfileScope(int32 InZoneId)
+        : ZoneId(InZoneId)
+        , StartCycles(FPlatformTime::Cycles64())
+    {
+        FNaughtyProfiler::EnterZone(ZoneId);
+    }
+
+    ~FNaughtyProfileScope()
+    {
+        FNaughtyProfiler::Record(ZoneId, FPlatformTime::Cycles64() - StartCycles);
+    }
+
+private:
+    int32 ZoneId;
+    uint64 StartCycles;
+};
+
+// NAUGHTY_PROFILE_SCOPE_CATEGORY(Name, Save) bills the zone to a perf monitor row; plain zones are billed nowhere
+#if NAUGHTY_PROFILING
+#define NAUGHTY_PROFILE_SCOPE_CATEGORY(Name, Category) \
+    static const int32 PREPROCESSOR_JOIN(NaughtyZoneId_, __LINE__) = FNaughtyProfiler::RegisterZone(FName(TEXT(#Name)), ENaughtyProfileCategory::Category); \
+    FNaughtyProfileScope PREPROCESSOR_JOIN(NaughtyZoneScope_, __LINE__)(PREPROCESSOR_JOIN(NaughtyZoneId_, __LINE__)); \
+    TRACE_CPUPROFILER_EVENT_SCOPE(Name)
+#else
+#define NAUGHTY_PROFILE_SCOPE_CATEGORY(Name, Category)
+#endif
+
+#define NAUGHTY_PROFILE_SCOPE(Name) NAUGHTY_PROFILE_SCOPE_CATEGORY(Name, None)
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Systems/NaughtySaveGame.h"
+
+/** Independently compressed parts of a save file; decode only what the caller needs */
+enum class ENaughtySaveSections : uint8
+{
+    None        = 0,
+    Info        = 1 << 0,   // Slot, save time, version, play time and level - what a save menu shows
+    Settings    = 1 << 1,
+    Progress    = 1 << 2,
+    World       = 1 << 3,
+    All         = Info | Settings | Progress | World
+};
+ENUM_CLASS_FLAGS(ENaughtySaveSections);
+
+/**
+ * Plain copy of everything UNaughtySaveGame persists
+ * Taken on the game thread so encoding, compression and file IO can run on a worker without touching UObjects
+ */
+struct FNaughtySaveSnapshot
+{
+    // Which parts below hold real data; the rest are defaults
+    ENaughtySaveSections Sections = ENaughtySaveSections::None;
+
+    FString SaveSlotName;
+    int32 SaveSlotIndex = 0;
+    FDateTime SaveTime;
+    FString SaveVersion;
+
+    FPlayerProgressData PlayerProgress;
+    FWorldStateData WorldState;
+    FGameSettings GameSettings;
+};
+
+/**
+ * On-disk save format: header, table of contents, then one zlib-compressed tagged-property payload per section
+ * Version 1 files (a single payload) still decode, always in full.
+ * Encode/Decode are thread-safe; Capture/Apply touch the save object and belong on the game thread
+ */
+class NAUGHTYSHIBA_API FNaughtySaveArchive
+{
+public:
+    enum class EDecodeResult : uint8
+    {
+        Success,
+        Legacy,     // Written by UGameplayStatics::SaveGameToSlot - load with LoadGameFromMemory
+        Corrupt
+    };
+
+    static void Capture(const UNaughtySaveGame& SaveGame, FNaughtySaveSnapshot& OutSnapshot);
+    // Copies only the sections the snapshot holds
+    static void Apply(const FNaughtySaveSnapshot& Snapshot, UNaughtySaveGame& SaveGame);
+
+    static bool Encode(const FNaughtySaveSnapshot& Snapshot, TArray<uint8>& OutBytes);
+
+    // Sections not asked for are never decompressed
+    static EDecodeResult Decode(const TArray<uint8>& Bytes, FNaughtySaveSnapshot& OutSnapshot, ENaughtySaveSections Sections = ENaughtySaveSections::All);
+
+    // Platform save system wrappers (same slot storage UGameplayStatics uses); safe off the game thread
+    static bool WriteSlot(const FString& SlotName, int32 SlotIndex, const TArray<uint8>& Bytes);
+    static bool ReadSlot(const FString& SlotName, int32 SlotIndex, TArray<uint8>& OutBytes);
+
+    static constexpr uint32 FileMagic = 0x4E534156;     // 'NSAV'
+    static constexpr int32 FormatVersion = 2;
+};
@@ -5,6 +5,26 @@
 #include "Engine/World.h"
 #include "NaughtySaveGame.generated.h"
 
+/** Dense set of save registry IDs (see UNaughtySaveIdRegistry), saved as packed 32-bit words */
+USTRUCT(BlueprintType)
+struct NAUGHTYSHIBA_API FNaughtyIdBitset
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<uint32> Words;
+
+    bool Contains(int32 Id) const
+    {
+        return Id >= 0 && Words.IsValidIndex(Id >> 5) && (Words[Id >> 5] & (1u << (Id & 31))) != 0;
+    }
+
+    // True if the bit was not set yet
+    bool Add(int32 Id);
+    void Remove(int32 Id);
+    int32 Num() const;
+};
+
 USTRUCT(BlueprintType)
 struct NAUGHTYSHIBA_API FPlayerProgressData
 {
@@ -22,17 +42,39 @@ struct NAUGHTYSHIBA_API FPlayerProgressData
     UPROPERTY(BlueprintReadWrite, Category = "Player Progress")
     int32 TerritoriesMarked = 0;
 
-    UPROPERTY(BlueprintReadWrite, Category = "Player Progress")
+    // Only names without a registry ID (unregistered or not yet migrated); registered ones are bits in the ID sets
+    // Hidden from Blueprint since they are not the full list - use the Get/Is accessors on USaveSystemManager
+    UPROPERTY()
     TArray<FString> UnlockedAreas;
 
-    UPROPERTY(BlueprintReadWrite, Category = "Player Progress")
+    UPROPERTY()
     TArray<FString> CompletedMissions;
 
+    UPROPERTY(BlueprintReadOnly, Category = "Player Progress")
+    FNaughtyIdBitset UnlockedAreaIds;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Progress")
+    FNaughtyIdBitset CompletedMissionIds;
+
     UPROPERTY(BlueprintReadWrite, Category = "Player Progress")
     float TotalPlayTime = 0.0f;
 
     UPROPERTY(BlueprintReadWrite, Category = "Player Progress")
     FString LastSaveLocation;
+
+    bool IsAreaUnlocked(const FString& AreaName) const;
+    bool IsMissionCompleted(const FString& MissionName) const;
+
+    // True if it wasn't unlocked/completed before
+    bool UnlockArea(const FString& AreaName);
+    bool CompleteMission(const FString& MissionName);
+
+    // Registered and unregistered names together
+    TArray<FString> GetUnlockedAreas() const;
+    TArray<FString> GetCompletedMissions() const;
+
+    // Moves names that have gained a registry ID out of the string arrays
+    void MigrateToIds();
 };
 
 USTRUCT(BlueprintType)
@@ -43,9 +85,17 @@ struct NAUGHTYSHIBA_API FWorldStateData
     UPROPERTY(BlueprintReadWrite, Category = "World State")
     TArray<FVector> TerritoryMarkers;
 
-    UPROPERTY(BlueprintReadWrite, Category = "World State")
+    // Only objects without a registry ID; registered ones are in WorldObjectIds (has a state) and WorldObjectStates
+    // Hidden from Blueprint for the same reason as UnlockedAreas
+    UPROPERTY()
     TMap<FString, bool> WorldObjects;
 
+    UPROPERTY(BlueprintReadOnly, Category = "World State")
+    FNaughtyIdBitset WorldObjectIds;
+
+    UPROPERTY(BlueprintReadOnly, Category = "World State")
+    FNaughtyIdBitset WorldObjectStates;
+
     UPROPERTY(BlueprintReadWrite, Category = "World State")
     TMap<FString, int32> NPCReputation;
 
@@ -54,6 +104,17 @@ struct NAUGHTYSHIBA_API FWorldStateData
 
     UPROPERTY(BlueprintReadWrite, Category = "World State")
     FString CurrentLevel;
+
+    // False if the object has no saved state
+    bool GetWorldObjectState(const FString& ObjectName, bool& bOutState) const;
+
+    // True if the stored state changed
+    bool SetWorldObjectState(const FString& ObjectName, bool bState);
+
+    // Registered and unregistered objects together
+    TMap<FString, bool> GetWorldObjectStates() const;
+
+    void MigrateToIds();
 };
 
 USTRUCT(BlueprintType)
@@ -141,7 +202,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void MigrateFromOldVersion(const FString& OldVersion);
 
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool NeedsMigration() const { return SaveVersion != CURRENT_SAVE_VERSION; }
+
+    // Call after editing this object directly rather than through USaveSystemManager; the next save is then written
+    // in full instead of appending the manager's change journal, which never saw the edit
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    void MarkDirty() { bNeedsFullSave = true; }
+
+    bool NeedsFullSave() const { return bNeedsFullSave; }
+    void ClearNeedsFullSave() { bNeedsFullSave = false; }
+
 private:
+    // Not saved - only describes this object against the journal of the slot it came from
+    bool bNeedsFullSave = false;
+
     // Current save system version for migration support
     static const FString CURRENT_SAVE_VERSION;
 };
\ No newline at end of file
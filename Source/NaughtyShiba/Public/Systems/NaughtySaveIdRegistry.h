@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/DeveloperSettings.h"
+#include "NaughtySaveIdRegistry.generated.h"
+
+enum class ENaughtySaveIdDomain : uint8
+{
+    Area,
+    Mission,
+    WorldObject,
+    Num
+};
+
+/**
+ * Stable integer IDs for the names the save system tracks
+ * An ID is the name's position in its list, so the lists are append-only: never reorder or remove an entry, or
+ * existing saves will point at the wrong name. Names not listed here are still saved, as plain strings.
+ */
+UCLASS(BlueprintType)
+class NAUGHTYSHIBA_API UNaughtySaveIdRegistry : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Save IDs")
+    TArray<FName> Areas;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Save IDs")
+    TArray<FName> Missions;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Save IDs")
+    TArray<FName> WorldObjects;
+
+    // INDEX_NONE for names without an ID
+    int32 FindId(ENaughtySaveIdDomain Domain, const FString& Name) const;
+    FName GetIdName(ENaughtySaveIdDomain Domain, int32 Id) const;
+
+    // Registry named in the project settings; loaded on the game thread by the save manager, then read-only and safe
+    // to use from save workers. nullptr when none is set up
+    static const UNaughtySaveIdRegistry* Get() { return ActiveRegistry; }
+    static void SetActive(const UNaughtySaveIdRegistry* Registry);
+
+    // Clears the active registry only if it is still this one, so a stale owner can't drop a newer registry
+    static void ClearActive(const UNaughtySaveIdRegistry* Registry);
+
+    virtual void PostLoad() override;
+    virtual void BeginDestroy() override;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+    const TArray<FName>& GetNames(ENaughtySaveIdDomain Domain) const;
+    void BuildLookup();
+
+    TMap<FName, int32> Lookup[(int32)ENaughtySaveIdDomain::Num];
+
+    static const UNaughtySaveIdRegistry* ActiveRegistry;
+};
+
+/**
+ * Project Settings > Game > Naughty Save System
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Naughty Save System"))
+class NAUGHTYSHIBA_API UNaughtySaveSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+    // Stable IDs for areas, missions and world objects; without one every name is saved as a string
+    UPROPERTY(Config, EditAnywhere, Category = "Save IDs")
+    TSoftObjectPtr<UNaughtySaveIdRegistry> IdRegistry;
+};
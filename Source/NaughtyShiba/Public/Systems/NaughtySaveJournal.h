@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Systems/NaughtySaveArchive.h"
+
+/**
+ * Append-only change journal that sits next to a save slot
+ * Each save-manager mutation is recorded as a small binary record; autosave appends the records gathered since the
+ * last flush as one length-prefixed block instead of rewriting the whole save. The journal header carries the
+ * generation (base SaveTime ticks) of the snapshot it applies to, so a journal left behind by an older snapshot is
+ * ignored on load. Compaction replays the journal into a fresh snapshot and starts an empty journal.
+ * State the manager has no mutation call for (settings, level, max courage) is re-recorded at every flush.
+ *
+ * Recording happens on the game thread; the static file functions are safe on a worker
+ */
+class NAUGHTYSHIBA_API FNaughtySaveJournal
+{
+public:
+    enum class ERecord : uint8
+    {
+        UnlockArea,
+        CompleteMission,
+        AddTerritoryMarker,
+        UpdateNPCReputation,    // Delta
+        SetWorldObjectState,
+        SetPlayerProgress,      // Courage, barks, territories
+        SetPlayTime,            // Absolute total
+        SetSaveTime,
+        SetSessionState,        // Max courage, last save location, current level
+        SetGameSettings         // Tagged properties, like the Settings section
+    };
+
+    // Recording
+    void RecordUnlockArea(const FString& AreaName);
+    void RecordCompleteMission(const FString& MissionName);
+    void RecordTerritoryMarker(const FVector& Location);
+    void RecordNPCReputation(const FString& NPCName, int32 ReputationChange);
+    void RecordWorldObjectState(const FString& ObjectName, bool bState);
+    void RecordPlayerProgress(float Courage, int32 Barks, int32 Territories);
+    void RecordPlayTime(float TotalPlayTime);
+    void RecordSaveTime(const FDateTime& SaveTime);
+    void RecordSessionState(float MaxCourage, const FString& LastSaveLocation, const FString& CurrentLevel);
+    void RecordGameSettings(const FGameSettings& Settings);
+
+    bool HasPendingRecords() const { return PendingRecords.Num() > 0; }
+
+    // Hands the unflushed records to the caller (one journal block)
+    TArray<uint8> TakePendingRecords();
+    void DiscardPendingRecords() { PendingRecords.Reset(); }
+
+    // Files
+    static FString GetJournalPath(const FString& SlotName, int32 SlotIndex);
+
+    // Starts an empty journal for a snapshot of this generation
+    static bool ResetFile(const FString& SlotName, int32 SlotIndex, int64 Generation);
+    static bool AppendBlock(const FString& SlotName, int32 SlotIndex, const TArray<uint8>& Records);
+    static void DeleteFile(const FString& SlotName, int32 SlotIndex);
+
+    // Returns the size of the journal up to the end of its last complete block, or INDEX_NONE if there is no journal
+    // for this generation. A torn tail (crash mid-append) is skipped and reported through bOutTornTail; blocks appended
+    // after it would never be read, so the caller must start a new journal before appending again
+    static int64 Replay(const FString& SlotName, int32 SlotIndex, int64 Generation, FNaughtySaveSnapshot& Snapshot, bool* bOutTornTail = nullptr);
+
+    // Folds the journal into the slot's snapshot; returns the new generation, 0 if the slot was left as it was, or
+    // INDEX_NONE if the snapshot was rewritten but a fresh journal could not be started
+    static int64 Compact(const FString& SlotName, int32 SlotIndex, int64 Generation, int64* OutSnapshotBytes = nullptr);
+
+    static int64 GetGeneration(const FNaughtySaveSnapshot& Snapshot) { return Snapshot.SaveTime.GetTicks(); }
+
+    static constexpr uint32 FileMagic = 0x4E534A52;     // 'NSJR'
+    static constexpr int32 FormatVersion = 2;     // 2 added SetSessionState/SetGameSettings; version 1 still replays
+    static constexpr int64 HeaderSize = sizeof(uint32) + sizeof(int32) + sizeof(int64);
+
+private:
+    static void ApplyRecords(const TArray<uint8>& Block, FNaughtySaveSnapshot& Snapshot);
+
+    TArray<uint8> PendingRecords;
+};
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NaughtySaveSlotIndex.generated.h"
+
+class UNaughtySaveGame;
+struct FNaughtySaveSnapshot;
+
+/** What a save browser shows for one slot, kept without opening the save itself */
+USTRUCT(BlueprintType)
+struct NAUGHTYSHIBA_API FNaughtySaveSlotInfo
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slot")
+    FString SlotName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slot")
+    int32 SlotIndex = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slot")
+    FDateTime SaveTime;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slot")
+    float PlayTimeHours = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slot")
+    FString CurrentLevel;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slot")
+    FString SaveVersion;
+
+    // Snapshot size on disk; the slot's journal is not included
+    UPROPERTY(BlueprintReadOnly, Category = "Save Slot")
+    int64 SizeBytes = 0;
+
+    static FNaughtySaveSlotInfo Make(const FNaughtySaveSnapshot& Snapshot, int64 SizeBytes);
+    static FNaughtySaveSlotInfo Make(const UNaughtySaveGame& SaveGame, int64 SizeBytes);
+
+    friend FArchive& operator<<(FArchive& Ar, FNaughtySaveSlotInfo& Info);
+};
+
+/**
+ * Slot metadata index kept next to the saves (Saved/SaveGames/SlotIndex.dat)
+ * Updated after every save and delete and rewritten atomically (temp file + rename), so the save browser never has
+ * to open a save body. On load it is reconciled against the platform save system's slot list, which picks up
+ * slots written by older builds or removed outside the game.
+ *
+ * Thread-safe: save workers update it directly
+ */
+class NAUGHTYSHIBA_API FNaughtySaveSlotIndex
+{
+public:
+    // Reads the index file and reconciles it with the saves that actually exist; game thread only
+    void Load();
+
+    // SizeBytes of INDEX_NONE keeps the size already indexed (journal-only saves don't rewrite the snapshot)
+    void Update(const FNaughtySaveSlotInfo& Info);
+    void Remove(const FString& SlotName, int32 SlotIndex);
+
+    bool Find(const FString& SlotName, int32 SlotIndex, FNaughtySaveSlotInfo& OutInfo) const;
+
+    // Newest first
+    TArray<FNaughtySaveSlotInfo> GetSlots() const;
+
+    static FString GetIndexPath();
+
+    static constexpr uint32 FileMagic = 0x4E534958;     // 'NSIX'
+    static constexpr int32 FormatVersion = 1;
+
+private:
+    // Caller holds Lock
+    bool Write() const;
+    int32 IndexOf(const FString& SlotName, int32 SlotIndex) const;
+
+    mutable FCriticalSection Lock;
+    TArray<FNaughtySaveSlotInfo> Slots;
+};
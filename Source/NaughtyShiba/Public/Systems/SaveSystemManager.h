@@ -3,6 +3,10 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Systems/NaughtySaveGame.h"
+#include "Systems/NaughtySaveArchive.h"
+#include "Systems/NaughtySaveJournal.h"
+#include "Systems/NaughtySaveSlotIndex.h"
+#include "Async/Future.h"
 #include "Engine/World.h"
 #include "SaveSystemManager.generated.h"
 
@@ -28,6 +32,8 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void SaveGame(const FString& SlotName = TEXT("DefaultSave"), int32 SlotIndex = 0);
 
+    // Snapshot now, encode and write on a worker; OnSaveComplete fires on the game thread
+    // Saving again to the slot last saved or loaded only appends the changes since then to its journal
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void SaveGameAsync(const FString& SlotName = TEXT("DefaultSave"), int32 SlotIndex = 0);
 
@@ -38,9 +44,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Save System")
     bool LoadGame(const FString& SlotName = TEXT("DefaultSave"), int32 SlotIndex = 0);
 
+    // Read and decode on a worker; OnLoadComplete fires on the game thread once CurrentSaveData is replaced
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void LoadGameAsync(const FString& SlotName = TEXT("DefaultSave"), int32 SlotIndex = 0);
 
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool IsAsyncOperationInProgress() const { return bRequestInFlight || PendingRequests.Num() > 0; }
+
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void QuickLoad();
 
@@ -51,13 +61,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Save System")
     bool DeleteSave(const FString& SlotName, int32 SlotIndex = 0);
 
+    // Every slot in the slot index, newest first - no save file is opened
     UFUNCTION(BlueprintCallable, Category = "Save System")
     TArray<FString> GetAllSaveSlots() const;
 
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    TArray<FNaughtySaveSlotInfo> GetSaveSlotInfos() const { return SlotMetadata->GetSlots(); }
+
+    // Only the slot info, save time, version, play time and current level are filled in, from the slot index when it
+    // knows the slot; the rest of the save is never decoded
     UFUNCTION(BlueprintCallable, Category = "Save System")
     UNaughtySaveGame* GetSaveGameInfo(const FString& SlotName, int32 SlotIndex = 0) const;
 
+    // Decodes just the settings section of a slot (e.g. at boot, before any game is loaded)
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool LoadSettings(const FString& SlotName, int32 SlotIndex, FGameSettings& OutSettings) const;
+
     // Current save data access
+    // Prefer the shortcuts below; after editing the returned object directly, call MarkDirty on it so the edit is saved
     UFUNCTION(BlueprintCallable, Category = "Save System")
     UNaughtySaveGame* GetCurrentSaveData() const { return CurrentSaveData; }
 
@@ -77,6 +98,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void CompleteMission(const FString& MissionName);
 
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool IsAreaUnlocked(const FString& AreaName) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool IsMissionCompleted(const FString& MissionName) const;
+
+    // Every unlocked area / completed mission by name, registered or not
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    TArray<FString> GetUnlockedAreas() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    TArray<FString> GetCompletedMissions() const;
+
     // World state shortcuts
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void AddTerritoryMarker(const FVector& Location);
@@ -87,6 +121,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void SetWorldObjectState(const FString& ObjectName, bool bState);
 
+    // False if the object has never had its state saved
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    bool GetWorldObjectState(const FString& ObjectName, bool& bOutState) const;
+
+    // Every world object with a saved state, by name
+    UFUNCTION(BlueprintCallable, Category = "Save System")
+    TMap<FString, bool> GetWorldObjectStates() const;
+
     // Auto-save functionality
     UFUNCTION(BlueprintCallable, Category = "Save System")
     void EnableAutoSave(float IntervalSeconds = 300.0f);
@@ -108,19 +150,80 @@ public:
     FOnSaveSlotDeleted OnSaveSlotDeleted;
 
 protected:
-    // Internal save operations
+    // Internal save operations (synchronous)
     void PerformSave(const FString& SlotName, int32 SlotIndex);
-    void PerformLoad(const FString& SlotName, int32 SlotIndex);
+    bool PerformLoad(const FString& SlotName, int32 SlotIndex);
 
     // Auto-save timer
     UFUNCTION()
     void AutoSaveTimer();
 
 private:
+    // Async requests run one at a time, in order; an identical request already waiting absorbs new ones
+    struct FSaveRequest
+    {
+        bool bSave = true;
+        FString SlotName;
+        int32 SlotIndex = 0;
+    };
+
+    void QueueRequest(bool bSave, const FString& SlotName, int32 SlotIndex);
+    void StartNextRequest();
+    void FinishSave(uint32 RequestSerial, const FString& SlotName, int32 SlotIndex, bool bSuccess, int64 ExpectedGeneration, int64 NewGeneration, int64 NewJournalBytes);
+    void FinishLoad(uint32 RequestSerial, const FString& SlotName, int32 SlotIndex, FNaughtySaveArchive::EDecodeResult Result, const FNaughtySaveSnapshot& Snapshot, const TArray<uint8>& Bytes, int64 BaseGeneration, int64 JournalBytes, bool bTornJournal);
+
+    // Blocks until the worker is done with the slot files (sync operations, slot queries and shutdown)
+    // Its completion still runs later on the game thread; StateSerial tells it whether it is stale by then
+    void WaitForInFlightRequest() const;
+
+    // Stamps slot info on the current data and copies it out for encoding
+    void CaptureForSave(const FString& SlotName, int32 SlotIndex, FNaughtySaveSnapshot& OutSnapshot);
+
+    // Journal state after a full save or load of a slot; generation 0 means the next save must be a full one
+    void BindJournal(const FString& SlotName, int32 SlotIndex, int64 Generation, int64 FileBytes);
+
+    // After a load: appending is only safe to a journal that replayed cleanly (see FNaughtySaveJournal::Replay)
+    void BindLoadedJournal(const FString& SlotName, int32 SlotIndex, int64 BaseGeneration, int64 JournalBytes, bool bTornJournal);
+    bool CanAppendToJournal(const FString& SlotName, int32 SlotIndex) const;
+
+    // New save object from decoded slot bytes, or nullptr
+    UNaughtySaveGame* CreateLoadedSave(FNaughtySaveArchive::EDecodeResult Result, const FNaughtySaveSnapshot& Snapshot, const TArray<uint8>& Bytes) const;
+
+    TArray<FSaveRequest> PendingRequests;
+    bool bRequestInFlight = false;
+    mutable TFuture<void> InFlightTask;
+
+    // Bumped by every sync operation that replaces CurrentSaveData or rebinds the journal; async completions from
+    // before the bump are stale and must not touch either
+    uint32 StateSerial = 0;
+
+    // Changes since the last flush, and the slot/snapshot generation they apply to
+    FNaughtySaveJournal Journal;
+    FString JournalSlotName;
+    int32 JournalSlotIndex = 0;
+    int64 JournalGeneration = 0;
+    int64 JournalFileBytes = 0;
+    int32 JournalFlushes = 0;
+
+    // Settings as of the last snapshot or settings record, so unchanged settings are not journaled again
+    FGameSettings JournaledSettings;
+
+    // Shared with the save workers, which update it after writing
+    TSharedRef<FNaughtySaveSlotIndex, ESPMode::ThreadSafe> SlotMetadata = MakeShared<FNaughtySaveSlotIndex, ESPMode::ThreadSafe>();
+
+    // Journals past this size, or this many flushes since the last snapshot, are folded into a new snapshot by the
+    // worker after appending
+    static constexpr int64 JournalCompactionBytes = 256 * 1024;
+    static constexpr int32 JournalCompactionFlushes = 32;
+
     // Current save data
     UPROPERTY()
     UNaughtySaveGame* CurrentSaveData;
 
+    // From UNaughtySaveSettings; kept alive here while it's the active registry
+    UPROPERTY()
+    class UNaughtySaveIdRegistry* IdRegistry;
+
     // Auto-save settings
     bool bAutoSaveEnabled = false;
     float AutoSaveInterval = 300.0f; // 5 minutes default
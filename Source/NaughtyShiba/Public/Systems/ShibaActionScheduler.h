@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShibaActionScheduler.generated.h"
+
+class AShibaCharacter;
+class AGMC_WorldTimeReplicator;
+
+/**
+ * Timed action slots a character can have pending
+ * Scheduling into a slot that is already pending replaces the old entry
+ */
+enum class EShibaActionSlot : uint8
+{
+    Bark,           // Bark auto-stop
+    Howl,           // Howl auto-stop
+    HeldAction,     // Return to Idle after marking / defecating / picking up
+    Count
+};
+
+/**
+ * Per-world scheduler for timed character actions
+ * Entries live in a hashed timing wheel keyed by GMC-replicated world time and are
+ * expired in one batch per frame; no timer handles or lambdas are allocated per action
+ */
+UCLASS()
+class NAUGHTYSHIBA_API UShibaActionScheduler : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    // Tickable interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UShibaActionScheduler* Get(const UObject* WorldContextObject);
+
+    // Schedule Slot to expire on Owner after Duration seconds, replacing any pending entry in that slot
+    void Schedule(AShibaCharacter* Owner, EShibaActionSlot Slot, float Duration);
+
+    // Same, measured from a GMC move timestamp so every simulation of the move expires at the same time.
+    // Falls back to the scheduler clock until the GMC time replicator is found, since the move time is on GMC's clock.
+    // A replayed move keeps the entry its original simulation scheduled
+    void ScheduleFromMove(AShibaCharacter* Owner, EShibaActionSlot Slot, float Duration, double MoveTime, bool bReplaying);
+
+    // Cancel a single pending slot; returns true if something was pending
+    bool Cancel(const AShibaCharacter* Owner, EShibaActionSlot Slot);
+
+    // Cancel every pending slot for Owner (EndPlay / CancelAllActions)
+    void CancelAll(const AShibaCharacter* Owner);
+
+    bool IsPending(const AShibaCharacter* Owner, EShibaActionSlot Slot) const;
+
+    // Scheduler clock - GMC replicated world time when available, local world time otherwise
+    double GetTimeSeconds() const;
+
+    int32 GetNumPending() const { return PendingIndex.Num(); }
+
+private:
+    struct FScheduledAction
+    {
+        TWeakObjectPtr<AShibaCharacter> Owner;
+        double ExpireTime = 0.0;
+        uint64 Key = 0;
+        int32 Bucket = INDEX_NONE;
+        EShibaActionSlot Slot = EShibaActionSlot::Count;
+    };
+
+    // Wheel layout: 64 buckets of 50ms cover 3.2s per revolution; longer delays wait extra revolutions
+    static constexpr int32 NumBuckets = 64;
+    static constexpr double BucketResolution = 0.05;
+
+    static uint64 MakeKey(const AShibaCharacter* Owner, EShibaActionSlot Slot);
+
+    int64 TimeToTick(double Time) const { return FMath::FloorToInt64(Time / BucketResolution); }
+
+    int32 AllocateEntry();
+    void RemoveEntry(int32 EntryIndex);
+    void FindTimeReplicator();
+    void AddEntry(AShibaCharacter* Owner, EShibaActionSlot Slot, double ExpireTime);
+
+    // Entry pool with free list so scheduling never allocates in steady state
+    TArray<FScheduledAction> Entries;
+    TArray<int32> FreeEntries;
+
+    // Entry indices per wheel bucket
+    TArray<int32> Buckets[NumBuckets];
+
+    // (Owner, Slot) -> entry index for replacement and cancellation
+    TMap<uint64, int32> PendingIndex;
+
+    // Entries that expired this frame, copied out before dispatch (reused between ticks)
+    TArray<TPair<TWeakObjectPtr<AShibaCharacter>, EShibaActionSlot>> ExpiredScratch;
+
+    // Last wheel tick that was fully processed
+    int64 LastProcessedTick = 0;
+    bool bWheelStarted = false;
+
+    TWeakObjectPtr<AGMC_WorldTimeReplicator> TimeReplicator;
+    double NextReplicatorSearchTime = 0.0;
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShibaSignificanceManager.generated.h"
+
+class AShibaCharacter;
+
+/**
+ * Update detail tiers for Shiba pawns, most significant first
+ */
+UENUM(BlueprintType)
+enum class EShibaSignificanceTier : uint8
+{
+    Local       UMETA(DisplayName = "Local"),       // Locally controlled - always full rate
+    Near        UMETA(DisplayName = "Near"),
+    Mid         UMETA(DisplayName = "Mid"),
+    Far         UMETA(DisplayName = "Far"),
+    Culled      UMETA(DisplayName = "Culled")       // Not rendered recently
+};
+
+/**
+ * What a pawn is allowed to spend in a given tier
+ * Tick intervals of 0 mean every frame
+ */
+struct FShibaSignificanceTierSettings
+{
+    float MaxDistance;              // Upper bound of the tier (cm), unused for Local/Culled
+    float ActorTickInterval;        // Also paces movement-driven character logic on simulated proxies
+    float MeshTickInterval;
+    float SimulatedMovementTickInterval;    // Only applied to simulated proxies
+    bool bCosmetics;                // Debug messages and optional effects
+};
+
+/**
+ * Scores remote Shiba pawns by distance to the local view and recent visibility,
+ * then pushes a significance tier to each pawn so far dogs tick less often
+ * Does nothing on dedicated servers (no view, and server movement must stay full rate)
+ */
+UCLASS()
+class NAUGHTYSHIBA_API UShibaSignificanceManager : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+
+    // Tickable interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UShibaSignificanceManager* Get(const UObject* WorldContextObject);
+
+    void RegisterCharacter(AShibaCharacter* Character);
+    void UnregisterCharacter(AShibaCharacter* Character);
+
+    static const FShibaSignificanceTierSettings& GetTierSettings(EShibaSignificanceTier Tier);
+
+    // Rate limiter for per-pawn work paced by a tier interval; advances NextUpdateTime when the update should run
+    static bool ShouldRunTierUpdate(float Interval, float TimeSeconds, float& NextUpdateTime);
+
+    // Number of registered pawns currently in Tier (debug/perf display)
+    int32 GetNumInTier(EShibaSignificanceTier Tier) const;
+
+private:
+    void EvaluateSignificance();
+    EShibaSignificanceTier ScoreCharacter(const AShibaCharacter* Character, const FVector& ViewLocation) const;
+
+    TArray<TWeakObjectPtr<AShibaCharacter>> Characters;
+
+    // Scoring is cheap but pointless every frame; re-evaluate a few times per second
+    static constexpr float EvaluationInterval = 0.2f;
+    float TimeUntilEvaluation = 0.0f;
+};
@@ -31,6 +31,7 @@ class NAUGHTYSHIBA_API UUIManager : public UGameInstanceSubsystem
 
 public:
     // Subsystem interface
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
     virtual void Deinitialize() override;
 
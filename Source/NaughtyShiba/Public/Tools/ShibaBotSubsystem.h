@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tools/ShibaInputScript.h"
+#include "ShibaBotSubsystem.generated.h"
+
+class AShibaCharacter;
+
+/**
+ * Bot client mode - drives the local Shiba from an input script instead of a player
+ * Enabled with -ShibaBot on a client, usually launched headless by the ShibaBotSwarm commandlet:
+ *
+ * UnrealEditor-Cmd NaughtyShiba.uproject 127.0.0.1 -game -nullrhi -nosound -ShibaBot [-BotSeed=N] [-BotPattern=abilities]
+ */
+UCLASS()
+class NAUGHTYSHIBA_API UShibaBotSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    // Tickable interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    void ReportStats(AShibaCharacter* Character);
+
+    TWeakObjectPtr<AShibaCharacter> ControlledCharacter;
+    FShibaInputScript Script;
+    EShibaInputPattern Pattern = EShibaInputPattern::Abilities;
+    int32 Seed = 0;
+
+    // Prediction counters go to the server once a second
+    static constexpr float ReportInterval = 1.0f;
+    float TimeUntilReport = ReportInterval;
+};
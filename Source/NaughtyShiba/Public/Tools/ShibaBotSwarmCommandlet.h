@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ShibaBotSwarmCommandlet.generated.h"
+
+/**
+ * Loopback load test - starts a dedicated server with -ShibaLoadReport, then ramps up headless -ShibaBot clients
+ * The server log and its CSV (Saved/LoadTest) show tick time, bandwidth and corrections as the bot count grows
+ *
+ * UnrealEditor-Cmd NaughtyShiba.uproject -run=ShibaBotSwarm -nullrhi -unattended
+ *     [-Bots=16] [-RampInterval=15] [-Hold=60] [-Map=/Game/Maps/GMC_TestLevel] [-Port=7777]
+ *     [-BotPattern=abilities] [-NoServer] [-ServerAddress=127.0.0.1]
+ */
+UCLASS()
+class NAUGHTYSHIBA_API UShibaBotSwarmCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UShibaBotSwarmCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+class AShibaCharacter;
+class UInputManagerComponent;
+enum class EShibaInputAction : uint8;
+
+/**
+ * Scripted input patterns for headless benchmarking and bot clients
+ */
+enum class EShibaInputPattern : uint8
+{
+    Wander,         // Walk in a random direction, change course every few seconds, sometimes stand still
+    Sprint,         // Wander while holding sprint
+    JumpSpam,       // Wander while jumping twice a second
+    CrouchToggle,   // Wander while toggling crouch every second
+    Mixed,          // Pick one of the above for each decision period
+    Abilities,      // Wander while using a random ability (bark, howl, sniff, mark, defecate, pick up) every few seconds
+    Count
+};
+
+/**
+ * Drives one AShibaCharacter from a deterministic input script
+ * Input is injected through the pawn's UInputManagerComponent so it takes the same path as a player
+ */
+struct NAUGHTYSHIBA_API FShibaInputScript
+{
+    void Initialize(EShibaInputPattern InPattern, int32 Seed);
+
+    // Call once per frame before the world ticks
+    void Step(AShibaCharacter* Character, float DeltaTime);
+
+    int32 GetNumActionsIssued() const { return NumActionsIssued; }
+
+    static bool ParsePattern(const FString& Name, EShibaInputPattern& OutPattern);
+    static const TCHAR* GetPatternName(EShibaInputPattern Pattern);
+
+private:
+    void Decide();
+    void Press(UInputManagerComponent* InputManager, EShibaInputAction Action);
+    void Release(UInputManagerComponent* InputManager, EShibaInputAction Action);
+
+    EShibaInputPattern Pattern = EShibaInputPattern::Wander;
+    EShibaInputPattern ActivePattern = EShibaInputPattern::Wander;
+    FRandomStream Stream;
+
+    FVector2D MoveInput = FVector2D::ZeroVector;
+    float TimeUntilDecision = 0.0f;
+    float TimeUntilAction = 0.0f;
+
+    // Actions pressed last step that need a release this step
+    TArray<EShibaInputAction, TInlineAllocator<4>> PendingReleases;
+
+    bool bSprintHeld = false;
+    bool bCrouchHeld = false;
+    int32 NumActionsIssued = 0;
+};
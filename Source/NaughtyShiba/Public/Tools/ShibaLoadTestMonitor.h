@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShibaLoadTestMonitor.generated.h"
+
+class UNetConnection;
+
+/**
+ * Server-side load report for bot swarms
+ * Enabled with -ShibaLoadReport on a listen or dedicated server; every few seconds logs and appends a CSV row with
+ * server tick time, bandwidth per connection and GMC correction rate (from the clients' reported replays)
+ *
+ * CSV goes to -ShibaLoadCsv=<file> or Saved/LoadTest/ShibaLoad_<timestamp>.csv
+ */
+UCLASS()
+class NAUGHTYSHIBA_API UShibaLoadTestMonitor : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Subsystem interface
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+    // Tickable interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    void WriteReport();
+
+    // Counters from the previous report, per connection, to turn cumulative client counts into rates
+    struct FConnectionSnapshot
+    {
+        int32 Replays = 0;
+        int32 Moves = 0;
+    };
+    TMap<TWeakObjectPtr<UNetConnection>, FConnectionSnapshot> Snapshots;
+
+    // Tick time accumulated since the last report (busy time, excluding the server's idle sleep)
+    double TickTimeSumMs = 0.0;
+    double TickTimeMaxMs = 0.0;
+    int32 NumTicks = 0;
+
+    double ElapsedSeconds = 0.0;
+    float TimeUntilReport = 0.0f;
+    float ReportInterval = 5.0f;
+
+    FString CsvPath;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ShibaMovementBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless benchmark for UShibaGMCMovement
+ * Loads a test map, spawns N Shiba pawns driven by scripted input and writes per-pawn cost as JSON
+ *
+ * UnrealEditor-Cmd NaughtyShiba.uproject -run=ShibaMovementBenchmark -nullrhi -unattended
+ *     [-Map=/Game/Maps/GMC_TestLevel] [-Pawns=32] [-Frames=600] [-Warmup=60] [-DeltaTime=0.016667]
+ *     [-Pattern=wander|sprint|jump|crouch|mixed|abilities] [-PawnClass=<class path>] [-Seed=1] [-Output=<file.json>]
+ */
+UCLASS()
+class NAUGHTYSHIBA_API UShibaMovementBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UShibaMovementBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
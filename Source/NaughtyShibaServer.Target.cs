@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+public class NaughtyShibaServerTarget : TargetRules
+{
+	public NaughtyShibaServerTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Server;
+		DefaultBuildSettings = BuildSettingsVersion.V4;
+		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_3;
+		ExtraModuleNames.Add("NaughtyShiba");
+
+		bUseUnityBuild = true;
+		bUsePCHFiles = true;
+		bForceEnableExceptions = false;
+
+		// Push-model replication for AShibaCharacter
+		bWithPushModel = true;
+
+		// Headless - no embedded browser in the binary
+		bCompileCEF3 = false;
+	}
+}